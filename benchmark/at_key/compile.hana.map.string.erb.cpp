@@ -0,0 +1,25 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
+namespace hana = boost::hana;
+
+<% key = -> (n) { "hana::string<#{"k#{n}".chars.map { |c| "'#{c}'" }.join(', ')}>" } %>
+
+int main() {
+    constexpr auto map = hana::make_map(
+        <%= (1..input_size).map { |n|
+            "hana::make_pair(#{key[n]}, hana::int_<#{n}>)"
+        }.join(', ') %>
+    );
+    <% (1..input_size).step([input_size / 10, 1].max).each { |n| %>
+        constexpr auto result<%= n %> = hana::at_key(map, <%= key[n] %>);
+        (void)result<%= n %>;
+    <% } %>
+}
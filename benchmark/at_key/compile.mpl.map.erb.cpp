@@ -0,0 +1,27 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/map.hpp>
+#include <boost/mpl/pair.hpp>
+namespace mpl = boost::mpl;
+
+
+template <int>
+struct x;
+
+using map = <%= (1..input_size).inject("mpl::map0<>") { |m, n|
+    "mpl::insert<#{m}, mpl::pair<x<#{n}>, mpl::int_<#{n}>>>::type"
+} %>;
+
+<% (1..input_size).step([input_size / 10, 1].max).each { |n| %>
+    using result<%= n %> = mpl::at<map, x<<%= n %>>>::type;
+<% } %>
+
+
+int main() { }
@@ -8,7 +8,22 @@ Distributed under the Boost Software License, Version 1.0.
   'use strict';
 
   var Hana = {};
+
+  // Default y axis title and tooltip suffix for each aspect measured by
+  // the `measure.rb` script. The aspect is given by the optional `aspect`
+  // field of the chart options, and defaults to `compilation_time`.
+  var aspects = {
+    compilation_time:   { title: "Time (s)", suffix: 's' },
+    execution_time:     { title: "Time (s)", suffix: 's' },
+    compilation_memory: { title: "Peak memory usage (MB)", suffix: 'MB' },
+    bloat:              { title: "Executable size (kb)", suffix: 'kb' },
+    instantiations:     { title: "Number of instantiations", suffix: '' }
+  };
+
   Hana.initChart = function(div, options) {
+    var aspect = aspects[options.aspect || 'compilation_time'];
+    delete options.aspect;
+
     if (options.xAxis == undefined) {
       options.xAxis = {
         title: { text: "Number of elements" },
@@ -18,7 +33,7 @@ Distributed under the Boost Software License, Version 1.0.
 
     if (options.yAxis == undefined) {
       options.yAxis = {
-        title: { text: "Time (s)" },
+        title: { text: aspect.title },
         floor: 0
       };
     }
@@ -36,7 +51,7 @@ Distributed under the Boost Software License, Version 1.0.
     }
 
     options.tooltip = options.tooltip || {};
-    options.tooltip.valueSuffix = options.tooltip.valueSuffix || 's';
+    options.tooltip.valueSuffix = options.tooltip.valueSuffix || aspect.suffix;
 
     if (options.legend == undefined) {
       options.legend = {
@@ -0,0 +1,37 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/foldable.hpp>
+using namespace boost::hana;
+
+
+struct Container;
+
+template <int i>
+struct container { struct hana { using datatype = Container; }; };
+
+namespace boost { namespace hana {
+    template <>
+    struct unpack_impl<Container> {
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs const&, F const& f)
+        { return f(); }
+    };
+
+    template <>
+    struct length_impl<Container> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&)
+        { return size_t<0>; }
+    };
+}}
+
+int main() {
+<% (0...input_size).each do |i| %>
+    constexpr container<<%= i %>> x<%= i %>{};
+    (void)length(x<%= i %>);
+<% end %>
+}
@@ -0,0 +1,41 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+#   define BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+#endif
+#include <boost/hana/foldable.hpp>
+using namespace boost::hana;
+
+
+template <int i>
+struct Container;
+
+template <int i>
+struct container { struct hana { using datatype = Container<i>; }; };
+
+namespace boost { namespace hana {
+    template <int i>
+    struct unpack_impl<Container<i>> {
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs const&, F const& f)
+        { return f(); }
+    };
+
+    template <int i>
+    struct length_impl<Container<i>> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&)
+        { return size_t<0>; }
+    };
+}}
+
+int main() {
+<% (0...input_size).each do |i| %>
+    constexpr container<<%= i %>> x<%= i %>{};
+    (void)length(x<%= i %>);
+<% end %>
+}
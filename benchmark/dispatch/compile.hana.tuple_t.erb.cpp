@@ -0,0 +1,18 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple.hpp>
+using namespace boost::hana;
+
+
+template <int i>
+struct x { };
+
+int main() {
+<% (0...input_size).each do |i| %>
+    (void)length(tuple_t<x<<%= i %>>>);
+<% end %>
+}
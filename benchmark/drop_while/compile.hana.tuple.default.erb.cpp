@@ -0,0 +1,29 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/orderable.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+struct in_first_half {
+    template <typename N>
+    constexpr auto operator()(N n) const {
+        return n <= boost::hana::int_<<%= input_size / 2 %>>;
+    }
+};
+
+int main() {
+    constexpr auto tuple = boost::hana::make_tuple(
+        <%= (1..input_size).map { |n| "boost::hana::int_<#{n}>" }.join(', ') %>
+    );
+    // Call the default implementation of `drop_while` directly.
+    auto result = boost::hana::drop_while_impl<
+        boost::hana::Tuple, boost::hana::when<true>
+    >::apply(tuple, in_first_half{});
+    (void)result;
+}
@@ -0,0 +1,24 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+
+template <int>
+struct x;
+
+int main() {
+    constexpr auto xs = boost::hana::tuple_t<
+        <%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>
+    >;
+    constexpr auto ys = boost::hana::make_tuple(
+        <%= (1..input_size).map { |n| "boost::hana::type<x<#{n}>>" }.join(', ') %>
+    );
+    constexpr auto result = boost::hana::equal(xs, ys);
+    (void)result;
+}
@@ -0,0 +1,35 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/ext/std/integral_constant.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <type_traits>
+
+
+template <int i>
+struct x { static constexpr int value = i; };
+
+template <typename T>
+struct is_even
+    : std::integral_constant<bool, T::value % 2 == 0>
+{ };
+
+struct is_even_type {
+    template <typename T>
+    constexpr auto operator()(T t) const {
+        return boost::hana::trait<is_even>(t);
+    }
+};
+
+int main() {
+    constexpr auto types = boost::hana::tuple_t<
+        <%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>
+    >;
+    constexpr auto result = boost::hana::filter(types, is_even_type{});
+    (void)result;
+}
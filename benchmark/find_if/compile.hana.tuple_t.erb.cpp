@@ -0,0 +1,21 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+
+template <int>
+struct x;
+
+int main() {
+    constexpr auto types = boost::hana::tuple_t<
+        <%= (1..input_size).map { |n| "x<#{n}>" }.join(', ') %>
+    >;
+    constexpr auto result = boost::hana::find_if(types,
+        boost::hana::equal.to(boost::hana::type<x<<%= input_size %>>>));
+    (void)result;
+}
@@ -0,0 +1,24 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+using namespace boost::hana;
+
+
+template <typename State, typename X>
+struct F { using type = X; };
+
+struct state { };
+
+template <int i>
+struct x { };
+
+int main() {
+<% (0...input_size).each do |i| %>
+    (void)fold.left(tuple_t<x<<%= i %>>, x<<%= i + 1 %>>>, type<state>, metafunction<F>);
+<% end %>
+}
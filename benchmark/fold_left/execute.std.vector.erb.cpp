@@ -0,0 +1,27 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/ext/std/vector.hpp>
+
+#include "measure.hpp"
+#include <cstdlib>
+#include <vector>
+
+
+int main () {
+    boost::hana::benchmark::measure([] {
+        long double result = 0;
+        for (int iteration = 0; iteration < 1 << 10; ++iteration) {
+            std::vector<int> values = {
+                <%= input_size.times.map { 'std::rand()' }.join(', ') %>
+            };
+
+            result += boost::hana::fold.left(values, 0, [](auto state, auto t) {
+                return state + t;
+            });
+        }
+    });
+}
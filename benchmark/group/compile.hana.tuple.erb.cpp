@@ -0,0 +1,25 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+struct same_decade {
+    template <typename N, typename M>
+    constexpr auto operator()(N n, M m) const {
+        return n / boost::hana::int_<10> == m / boost::hana::int_<10>;
+    }
+};
+
+int main() {
+    constexpr auto tuple = boost::hana::make_tuple(
+        <%= (1..input_size).map { |n| "boost::hana::int_<#{n}>" }.join(', ') %>
+    );
+    auto result = boost::hana::group(tuple, same_decade{});
+    (void)result;
+}
@@ -0,0 +1,11 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+// BOOST_HANA_AMALGAMATED_HEADER is defined by CMake; see the 'amalgamate' target.
+#include BOOST_HANA_AMALGAMATED_HEADER
+
+
+int main() { }
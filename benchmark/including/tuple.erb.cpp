@@ -0,0 +1,19 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+<%
+  # The first `input_size` headers of `boost/hana/tuple/` are included,
+  # starting with the core, so each data point adds the cost of one header.
+  headers = %w(core foldable iterable searchable functor applicative
+               monad monad_plus comparable orderable sequence)
+%>
+
+<% headers.take(input_size).each do |header| %>
+#include <boost/hana/tuple/<%= header %>.hpp>
+<% end %>
+
+
+int main() { }
@@ -0,0 +1,17 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple.hpp>
+
+
+template <int i>
+struct x { };
+
+<% (0...input_size).each do |i| %>
+static_assert(sizeof(boost::hana::_tuple<x<<%= i %>>, x<<%= i + 1 %>>>) > 0, "");
+<% end %>
+
+int main() { }
@@ -6,8 +6,10 @@
 #
 #
 # When called as a program, this script runs the command line given in
-# arguments and returns the total time. This is similar to the `time`
-# command from Bash.
+# arguments and returns the total time and the peak memory usage of the
+# processes it spawned. This is similar to the `time` command from Bash.
+# If the command line contains Clang's `-ftime-trace` option, it also returns
+# a summary of the template instantiations performed by the compiler.
 #
 # This file can also be required as a Ruby module to gain access to the
 # methods defined below.
@@ -16,6 +18,8 @@
 # This file must not be used as-is. It must be processed by CMake first.
 
 require 'benchmark'
+require 'fiddle'
+require 'json'
 require 'open3'
 require 'pathname'
 require 'ruby-progressbar'
@@ -68,8 +72,71 @@ def cmake_bool(b)
   return false # otherwise
 end
 
-# aspect must be one of :compilation_time, :bloat, :execution_time
-def measure(aspect, template_relative, range)
+# Returns the peak resident set size, in kilobytes, of the largest child
+# process that has terminated and been waited for, or nil if it can't be
+# determined. Since the compiler driver waits for the compiler proper, this
+# includes it even though it is not a direct child.
+def children_peak_memory
+  getrusage = Fiddle::Function.new(Fiddle.dlopen(nil)['getrusage'],
+                                   [Fiddle::TYPE_INT, Fiddle::TYPE_VOIDP],
+                                   Fiddle::TYPE_INT)
+  rusage = Fiddle::Pointer.malloc(256, Fiddle::RUBY_FREE)
+  rusage_children = -1
+  return nil if getrusage.call(rusage_children, rusage) != 0
+
+  # `ru_maxrss` comes right after the two `struct timeval`s at the beginning
+  # of `struct rusage`. It is in bytes on OS X, and in kilobytes elsewhere.
+  maxrss = rusage[4 * Fiddle::SIZEOF_LONG, Fiddle::SIZEOF_LONG].unpack('l!')[0]
+  RUBY_PLATFORM =~ /darwin/ ? maxrss / 1024 : maxrss
+rescue Fiddle::DLError
+  nil
+end
+
+# Returns the name of the entity whose instantiation is described by the
+# given `-ftime-trace` detail string, without its template arguments and
+# without the `boost::hana::` prefix. For example, all the instantiations
+# of `boost::hana::detail::closure_impl<...>` are grouped together under
+# `detail::closure_impl`.
+def instantiated_entity(detail)
+  operators = /operator(<=>|<<=|>>=|<<|>>|<=|>=|->\*|->|<|>)/
+  name = detail.gsub(operators) { |op| op.tr('<>', '{}') }
+  nil while name.gsub!(/<[^<>]*>/, '')
+  name = name.gsub(/operator\S+/) { |op| op.tr('{}', '<>') }
+  name.strip.sub(/^boost::hana::/, '')
+end
+
+# Returns a Hash mapping each entity instantiated during the compilation
+# traced in the given `-ftime-trace` file to the number of times it was
+# instantiated and the time spent instantiating it, in microseconds. The
+# time spent in nested instantiations is only attributed to the nested
+# entity, so that the times can be added up.
+def instantiation_profile(trace_file)
+  kinds = ["InstantiateClass", "InstantiateFunction"]
+  events = JSON.parse(File.read(trace_file))["traceEvents"].select { |e|
+    e["ph"] == "X" && kinds.include?(e["name"])
+  }.sort_by { |e| [e["ts"], -e["dur"]] }
+
+  profile = Hash.new { |h, entity| h[entity] = {"count" => 0, "time" => 0} }
+  stack = []
+  events.each do |e|
+    stack.pop while !stack.empty? && stack.last["ts"] + stack.last["dur"] <= e["ts"]
+    profile[stack.last[:entity]]["time"] -= e["dur"] unless stack.empty?
+
+    e[:entity] = instantiated_entity(e["args"]["detail"])
+    profile[e[:entity]]["count"] += 1
+    profile[e[:entity]]["time"] += e["dur"]
+    stack.push(e)
+  end
+  profile
+end
+
+# aspect must be one of :compilation_time, :compilation_memory, :bloat,
+# :execution_time, :instantiations
+#
+# target is the name of the measure target used to compile the file, without
+# the `compile.` or `run.` prefix. Other measure targets than the default one
+# compile the same `measure.cpp` file, but with different compiler flags.
+def measure(aspect, template_relative, range, target = "benchmark.measure")
   measure_file = Pathname.new("@CMAKE_CURRENT_SOURCE_DIR@/measure.cpp")
   template = Pathname.new(template_relative).expand_path
   range = range.to_a
@@ -93,14 +160,16 @@ def measure(aspect, template_relative, range)
     code = Tilt::ERBTemplate.new(template).render(nil, input_size: n)
     measure_file.write(code)
 
-    # Compile the file and get timing statistics. The timing statistics
+    # Compile the file and get timing and memory statistics. The statistics
     # are output to stdout when we compile the file because of the way
     # the `compile.benchmark.measure` CMake target is setup.
-    stdout, stderr, status = make["compile.benchmark.measure"]
+    stdout, stderr, status = make["compile.#{target}"]
     raise "compilation error: #{stderr}\n\n#{code}" if not status.success?
     ctime = stdout.match(/\[compilation time: (.+)\]/i)
+    cmemory = stdout.match(/\[compilation memory: (.+)\]/i)
+    cinstantiations = stdout.match(/\[instantiations: (.+)\]/i)
     # Size of the generated executable in KB
-    size = File.size("@CMAKE_CURRENT_BINARY_DIR@/compile.benchmark.measure").to_f / 1000
+    size = File.size("@CMAKE_CURRENT_BINARY_DIR@/compile.#{target}").to_f / 1000
 
     # If we didn't match anything, that's because we went too fast, CMake
     # did not have the time to see the changes to the measure file and
@@ -110,11 +179,27 @@ def measure(aspect, template_relative, range)
     stat = ctime.captures[0].to_f if aspect == :compilation_time
     stat = size if aspect == :bloat
 
+    # Peak memory usage of the compiler in MB
+    if aspect == :compilation_memory
+      raise "the peak memory usage of the compiler is not available " +
+            "on this platform" if cmemory.nil?
+      stat = cmemory.captures[0].to_f / 1024
+    end
+
+    # Instantiation profile of the compilation, as returned by
+    # `instantiation_profile`. This requires a target compiled
+    # with `-ftime-trace`.
+    if aspect == :instantiations
+      raise "no instantiation profile was found; is the #{target} target " +
+            "compiled with -ftime-trace?" if cinstantiations.nil?
+      stat = JSON.parse(cinstantiations.captures[0])
+    end
+
     # Run the resulting program and get timing statistics. The statistics
     # should be written to stdout by the `measure` function of the
     # `measure.hpp` header.
     if aspect == :execution_time
-      stdout, stderr, status = make["run.benchmark.measure"]
+      stdout, stderr, status = make["run.#{target}"]
       raise "runtime error: #{stderr}\n\n#{code}" if not status.success?
       match = stdout.match(/\[execution time: (.+)\]/i)
       if match.nil?
@@ -133,18 +218,64 @@ ensure
   progress.finish if progress
 end
 
-def time_execution(erb_file, range)
-  measure(:execution_time, erb_file, range)
+def time_execution(erb_file, range, target = "benchmark.measure")
+  measure(:execution_time, erb_file, range, target)
+end
+
+def time_compilation(erb_file, range, target = "benchmark.measure")
+  measure(:compilation_time, erb_file, range, target)
 end
 
-def time_compilation(erb_file, range)
-  measure(:compilation_time, erb_file, range)
+def memory_compilation(erb_file, range, target = "benchmark.measure")
+  measure(:compilation_memory, erb_file, range, target)
+end
+
+# Returns the series of a chart showing, for each of the `top` entities with
+# the most instantiations, the number of times it is instantiated (`:count`)
+# or the time spent instantiating it in ms (`:time`) for each input size.
+# The remaining entities are grouped in a single series.
+def instantiation_series(erb_file, range, value = :count, top = 10,
+                         target = "benchmark.measure.time_trace")
+  data = measure(:instantiations, erb_file, range, target)
+  get = -> (profile, entity) {
+    stats = profile.fetch(entity, {"count" => 0, "time" => 0})
+    value == :count ? stats["count"] : stats["time"].to_f / 1000
+  }
+
+  entities = data.flat_map { |_, profile| profile.keys }.uniq
+  entities = entities.sort_by { |e| -data.map { |_, p| get[p, e] }.reduce(0, :+) }
+  shown, others = entities.take(top), entities.drop(top)
+
+  series = shown.map { |e|
+    {name: e, data: data.map { |n, p| [n, get[p, e]] }}
+  }
+  if not others.empty?
+    series << {
+      name: "#{others.size} other entities",
+      data: data.map { |n, p| [n, others.map { |e| get[p, e] }.reduce(0, :+)] }
+    }
+  end
+  series.to_json
 end
 
 if __FILE__ == $0
   command = ARGV.join(' ')
+
+  # Clang writes the -ftime-trace file next to the object file, replacing
+  # its extension. We remove any stale trace so we never report it.
+  output = ARGV[ARGV.index('-o') + 1] if ARGV.include?('-o')
+  if ARGV.include?('-ftime-trace') && output
+    trace = output.sub(/\.[^.\/]*\z/, '') + '.json'
+    File.delete(trace) if File.exist?(trace)
+  end
+
   time = Benchmark.realtime { `#{command}` }
+  memory = children_peak_memory
 
   puts "[command line: #{command}]"
   puts "[compilation time: #{time}]"
+  puts "[compilation memory: #{memory}]" if memory
+  if trace && File.exist?(trace)
+    puts "[instantiations: #{instantiation_profile(trace).to_json}]"
+  end
 end
@@ -0,0 +1,28 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+struct is_even {
+    template <typename N>
+    constexpr auto operator()(N n) const {
+        return n % boost::hana::int_<2> == boost::hana::int_<0>;
+    }
+};
+
+int main() {
+    constexpr auto tuple = boost::hana::make_tuple(
+        <%= (1..input_size).map { |n| "boost::hana::int_<#{n}>" }.join(', ') %>
+    );
+    // Call the default implementation of `partition` directly.
+    auto result = boost::hana::partition_impl<
+        boost::hana::Tuple, boost::hana::when<true>
+    >::apply(tuple, is_even{});
+    (void)result;
+}
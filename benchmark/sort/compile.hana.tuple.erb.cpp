@@ -0,0 +1,26 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/orderable.hpp>
+#include <boost/hana/tuple.hpp>
+
+
+struct greater {
+    template <typename X, typename Y>
+    constexpr auto operator()(X x, Y y) const {
+        return boost::hana::less(y, x);
+    }
+};
+
+int main() {
+    constexpr auto tuple = boost::hana::make_tuple(
+        <%= (1..input_size).to_a.shuffle(random: Random.new(input_size))
+                           .map { |n| "boost::hana::int_<#{n}>" }.join(', ') %>
+    );
+    constexpr auto result = boost::hana::sort(tuple, greater{});
+    (void)result;
+}
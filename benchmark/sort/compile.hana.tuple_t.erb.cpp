@@ -0,0 +1,30 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/orderable.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+
+template <int n>
+struct x { char c[n]; };
+
+struct smaller {
+    template <typename X, typename Y>
+    constexpr auto operator()(X x, Y y) const {
+        return boost::hana::less(boost::hana::sizeof_(x),
+                                 boost::hana::sizeof_(y));
+    }
+};
+
+int main() {
+    constexpr auto types = boost::hana::tuple_t<
+        <%= (1..input_size).to_a.shuffle(random: Random.new(input_size))
+                           .map { |n| "x<#{n}>" }.join(', ') %>
+    >;
+    constexpr auto result = boost::hana::sort(types, smaller{});
+    (void)result;
+}
@@ -0,0 +1,22 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/mpl/greater.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/sort.hpp>
+#include <boost/mpl/vector.hpp>
+namespace mpl = boost::mpl;
+
+
+using vector = <%= mpl_vector((1..input_size).to_a.shuffle(random: Random.new(input_size))
+                                             .map { |n| "mpl::int_<#{n}>" }) %>;
+
+using result = mpl::sort<vector, mpl::greater<mpl::_1, mpl::_2>>::type;
+
+
+int main() { }
@@ -0,0 +1,21 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/set.hpp>
+#include <boost/hana/tuple.hpp>
+namespace hana = boost::hana;
+
+
+template <int>
+struct x { };
+
+int main() {
+    constexpr auto types = hana::tuple_t<
+        <%= (1..input_size).map { |n| "x<#{n / 2}>" }.join(', ') %>
+    >;
+    constexpr auto set = hana::to<hana::Set>(types);
+    (void)set;
+}
@@ -0,0 +1,26 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/insert.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/set.hpp>
+#include <boost/mpl/vector.hpp>
+namespace mpl = boost::mpl;
+
+
+template <int>
+struct x;
+
+using vector = <%= mpl_vector((1..input_size).to_a.map { |n| "x<#{n / 2}>" }) %>;
+
+using result = mpl::fold<
+    vector, mpl::set0<>, mpl::insert<mpl::_1, mpl::_2>
+>::type;
+
+
+int main() { }
@@ -0,0 +1,113 @@
+#!/usr/bin/env ruby
+#
+# Copyright Louis Dionne 2015
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+#
+#
+# This script generates versions of the headers of the library that are
+# faster to preprocess, because they do not contain any comments.
+#
+# Usage:
+#   amalgamate.rb single <include-dir> <output-file>
+#     Writes the `boost/hana.hpp` header found in <include-dir> and all
+#     the headers it includes (transitively) into a single file, without
+#     comments. The include guards of the inlined headers are collapsed;
+#     their macros are still defined, so including one of the original
+#     headers afterwards is harmless.
+#
+#   amalgamate.rb headers <include-dir> <output-dir>
+#     Writes a copy of every header found in <include-dir> to <output-dir>,
+#     without comments. <output-dir> can then be used in place of
+#     <include-dir> in the include path. Includes are not rewritten to
+#     relative paths, because some compilers consider `fwd/../config.hpp`
+#     and `config.hpp` as different files and would read headers again.
+
+require 'fileutils'
+require 'pathname'
+
+
+# Matches a comment, or a string or character literal which may contain
+# something looking like a comment. Literals never span lines; stopping at
+# the end of the line also handles stray quotes in `#error` directives.
+COMMENT_OR_LITERAL = %r{
+    //(?:\\\n|[^\n])*
+  | /\*.*?\*/
+  | "(?:\\.|[^"\\\n])*"?
+  | '(?:\\.|[^'\\\n])*'?
+}mx
+
+# Removes the comments from the given C++ source code. Every comment is
+# replaced by a single space, but the newlines inside comments are kept
+# so that line splices and preprocessor directives are not affected.
+def strip_comments(code)
+  code.gsub(COMMENT_OR_LITERAL) { |match|
+    match.start_with?('/') ? ' ' + "\n" * match.count("\n") : match
+  }
+end
+
+# Strips the comments and the blank lines of a header. A blank line is
+# kept when it terminates a macro definition continued with a backslash.
+def strip(code)
+  lines = strip_comments(code).lines.map(&:rstrip)
+  lines.each_with_index.select { |line, index|
+    !line.empty? || (index > 0 && lines[index - 1].end_with?("\\"))
+  }.map { |line, _| line + "\n" }.join
+end
+
+INCLUDE = /^\s*#\s*include\s*<(boost\/hana(?:\/[\w\/.]+|\.hpp))>/
+CONDITIONAL = /^\s*#\s*if/
+ENDIF = /^\s*#\s*endif/
+
+# Returns the name of the include guard of a stripped header, if any.
+def include_guard(lines)
+  return nil if lines.length < 2
+  guard = lines[0][/^\s*#\s*ifndef\s+(\w+)/, 1]
+  guard if guard && lines[1] =~ /^\s*#\s*define\s+#{guard}\s*$/
+end
+
+def amalgamate(include_dir, header, seen, out)
+  return if seen.include?(header)
+  lines = strip(File.read(File.join(include_dir, header), encoding: 'UTF-8')).lines
+  guard = include_guard(lines)
+  # Headers without an include guard are inlined every time.
+  seen << header if guard
+  lines.shift if guard # #ifndef GUARD; the #define is kept
+  depth = guard ? 1 : 0
+  lines.each do |line|
+    if line =~ CONDITIONAL
+      depth += 1
+    elsif line =~ ENDIF
+      depth -= 1
+      next if guard && depth == 0
+    elsif (included = line[INCLUDE, 1]) && depth <= (guard ? 1 : 0)
+      amalgamate(include_dir, included, seen, out)
+      next
+    end
+    # Conditional includes of the library are left as-is, so they are
+    # only found when the original headers are in the include path.
+    out << line
+  end
+end
+
+mode, include_dir, output = ARGV
+case mode
+when 'single'
+  out = ''
+  amalgamate(include_dir, 'boost/hana.hpp', [], out)
+  guard = include_guard(strip(File.read(File.join(include_dir, 'boost/hana.hpp'), encoding: 'UTF-8')).lines)
+  FileUtils.mkdir_p(File.dirname(output))
+  File.write(output, "#ifndef #{guard}\n#{out}#endif\n")
+
+when 'headers'
+  root = Pathname.new(include_dir)
+  Dir.glob(File.join(include_dir, 'boost', '**', '*.hpp')).each do |file|
+    header = Pathname.new(file).relative_path_from(root)
+    destination = File.join(output, header)
+    FileUtils.mkdir_p(File.dirname(destination))
+    File.write(destination, strip(File.read(file, encoding: 'UTF-8')))
+  end
+
+else
+  abort "usage: #{$0} single|headers <include-dir> <output>"
+end
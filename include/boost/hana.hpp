@@ -28,6 +28,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/monoid.hpp>
 #include <boost/hana/orderable.hpp>
 #include <boost/hana/product.hpp>
+#include <boost/hana/random_access_iterable.hpp>
 #include <boost/hana/ring.hpp>
 #include <boost/hana/searchable.hpp>
 #include <boost/hana/sequence.hpp>
@@ -1281,6 +1282,13 @@ the library was also intentionally kept simple, because we all love simplicity.
     This subdirectory contains various function objects that are often useful,
     but that do not necessarily belong to a concept.
 
+  - `boost/hana/tuple/`\n
+    This subdirectory contains the definition of `Tuple`, split into a
+    minimal `core.hpp` header and one header per concept modeled by `Tuple`.
+    `boost/hana/tuple.hpp` includes all of them; including only the headers
+    that are needed reduces compile times in translation units that make
+    a light use of tuples.
+
   - `boost/hana/ext/`\n
     This directory contains adapters for external libraries. Only the strict
     minimum required to adapt the external components is included in these
@@ -1293,6 +1301,11 @@ the library was also intentionally kept simple, because we all love simplicity.
     This directory contains utilities required internally. Nothing in `detail/`
     is guaranteed to be stable, so you should not use it.
 
+Finally, `boost/hana/module.modulemap` describes the library as a single
+Clang module containing `boost/hana.hpp` and everything it includes. It can
+be used with `-fmodules -fmodule-map-file=<path to the module map>`, so the
+library is only parsed once instead of in every translation unit.
+
 
 
 
@@ -40,10 +40,10 @@ namespace boost { namespace hana {
     template <typename F, typename X>
     constexpr decltype(auto) _ap::operator()(F&& f, X&& x) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-        static_assert(_models<Applicative, typename datatype<F>::type>{},
+        static_assert(_models<Applicative, typename datatype<F>::type>::value,
         "hana::ap(f, x) requires f to be an Applicative");
 
-        static_assert(_models<Applicative, typename datatype<X>::type>{},
+        static_assert(_models<Applicative, typename datatype<X>::type>::value,
         "hana::ap(f, x) requires x to be an Applicative");
 #endif
         return ap_impl<typename datatype<F>::type>::apply(
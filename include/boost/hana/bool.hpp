@@ -76,10 +76,6 @@ namespace boost { namespace hana {
     template <typename T, T v>
     constexpr ic_detail::_times<T, v> _integral_constant<T, v>::times;
 
-    template <typename T, T v>
-    struct datatype<_integral_constant<T, v>> {
-        using type = IntegralConstant<T>;
-    };
     //! @endcond
 
     //////////////////////////////////////////////////////////////////////////
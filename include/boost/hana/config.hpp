@@ -87,6 +87,30 @@ Distributed under the Boost Software License, Version 1.0.
 #   define BOOST_HANA_CONSTEXPR_LAMBDA /* nothing */
 #endif
 
+// BOOST_HANA_CONFIG_HAS_BUILTIN(name) is true when `name` is a compiler
+// builtin (a function, type trait or template) that can be used instead of
+// a portable implementation. It is always false when the builtins are
+// disabled with BOOST_HANA_CONFIG_DISABLE_BUILTINS.
+#if !defined(BOOST_HANA_CONFIG_DISABLE_BUILTINS) && defined(__has_builtin)
+#   define BOOST_HANA_CONFIG_HAS_BUILTIN(name) __has_builtin(name)
+#else
+#   define BOOST_HANA_CONFIG_HAS_BUILTIN(name) 0
+#endif
+
+// Detect the compiler builtins used to create integer sequences and to
+// index parameter packs without instantiating any template.
+#if BOOST_HANA_CONFIG_HAS_BUILTIN(__make_integer_seq)
+#   define BOOST_HANA_CONFIG_HAS_BUILTIN_MAKE_INTEGER_SEQ
+#endif
+
+#if BOOST_HANA_CONFIG_HAS_BUILTIN(__integer_pack)
+#   define BOOST_HANA_CONFIG_HAS_BUILTIN_INTEGER_PACK
+#endif
+
+#if BOOST_HANA_CONFIG_HAS_BUILTIN(__type_pack_element)
+#   define BOOST_HANA_CONFIG_HAS_BUILTIN_TYPE_PACK_ELEMENT
+#endif
+
 // The std::tuple adapter is broken on libc++ prior to the one shipped
 // with Clang 3.7.0.
 #if defined(BOOST_HANA_CONFIG_LIBCPP) &&                                    \
@@ -149,19 +173,48 @@ Distributed under the Boost Software License, Version 1.0.
 
 #if defined(BOOST_HANA_DOXYGEN_INVOKED)
     //! @ingroup group-config
-    //! Disables data type checks in the methods.
+    //! Disables concept checks in the methods.
     //!
-    //! When this macro is not defined, tag-dispatched methods will make sure
-    //! the arguments they are passed are models of the proper concept(s).
-    //! This can be very helpful in catching programming errors, but it is
+    //! When this macro is not defined, tag-dispatched methods make sure the
+    //! arguments they are passed are models of the proper concept(s), and
+    //! fail with a `static_assert` otherwise. This can be very helpful in
+    //! catching programming errors, but checking `_models` at every call is
     //! also slightly less compile-time efficient. You should probably always
-    //! leave the checks enabled, except perhaps in translation units that are
-    //! compiled very often but whose code using Hana is modified very rarely.
+    //! leave the checks enabled while developing, and only disable them in
+    //! builds of code that is known to be correct, like release builds or
+    //! translation units that are compiled very often but whose code using
+    //! Hana is modified very rarely.
+    //!
+    //! Code that compiles with the checks enabled behaves the same with the
+    //! checks disabled. When the checks are disabled, invalid code fails
+    //! inside the implementation instead, with a less helpful diagnostic.
+#   define BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+#endif
+
+#if defined(BOOST_HANA_DOXYGEN_INVOKED)
+    //! @ingroup group-config
+    //! Older name of @ref BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS, which is
+    //! still honored.
 #   define BOOST_HANA_CONFIG_DISABLE_DATA_TYPE_CHECKS
 #endif
 
-#ifndef BOOST_HANA_CONFIG_DISABLE_DATA_TYPE_CHECKS
+#if !defined(BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS) && \
+    !defined(BOOST_HANA_CONFIG_DISABLE_DATA_TYPE_CHECKS)
 #   define BOOST_HANA_CONFIG_CHECK_DATA_TYPES
 #endif
 
+#if defined(BOOST_HANA_DOXYGEN_INVOKED)
+    //! @ingroup group-config
+    //! Disables the use of compiler builtins in the implementation of
+    //! basic utilities.
+    //!
+    //! When the compiler provides builtins like `__make_integer_seq`,
+    //! `__type_pack_element` or `__is_same`, Hana uses them to implement
+    //! some basic operations and type traits without instantiating templates
+    //! recursively. When this macro is defined, the portable implementations
+    //! are always used instead. This is mostly useful for benchmarking or
+    //! for working around a buggy builtin.
+#   define BOOST_HANA_CONFIG_DISABLE_BUILTINS
+#endif
+
 #endif // !BOOST_HANA_CONFIG_HPP
@@ -45,7 +45,7 @@ namespace boost { namespace hana {
         >::type;
 
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-        static_assert(_models<Constant, typename datatype<RawT>::type>{},
+        static_assert(_models<Constant, typename datatype<RawT>::type>::value,
         "hana::value<T>() requires T to be a Constant");
 #endif
 
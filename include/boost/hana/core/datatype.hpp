@@ -29,11 +29,29 @@ namespace boost { namespace hana {
         using type = typename T::hana::datatype;
     };
 
+    // Fast path for types with a nested `hana::datatype`, which is the case
+    // of all the data types of the library. The data type is known after a
+    // single instantiation, without going through `when<true>` first. The
+    // second condition excludes cv-qualified types, which are handled by
+    // the specializations below.
+    template <typename T>
+    struct datatype<T, decltype(
+        (void)static_cast<typename T::hana::datatype*>(nullptr),
+        (void)static_cast<void*>(static_cast<T*>(nullptr))
+    )> {
+        using type = typename T::hana::datatype;
+    };
+
     template <typename T> struct datatype<T const> : datatype<T> { };
     template <typename T> struct datatype<T volatile> : datatype<T> { };
     template <typename T> struct datatype<T const volatile> : datatype<T> { };
     template <typename T> struct datatype<T&> : datatype<T> { };
     template <typename T> struct datatype<T&&> : datatype<T> { };
+
+    // Algorithms are mostly called with `T const&`; stripping both qualifiers
+    // at once saves an instantiation of `datatype<T const>`.
+    template <typename T> struct datatype<T const&> : datatype<T> { };
+    template <typename T> struct datatype<T const&&> : datatype<T> { };
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_CORE_DATATYPE_HPP
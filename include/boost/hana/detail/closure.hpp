@@ -12,13 +12,67 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/is_empty.hpp>
+#include <boost/hana/detail/std/is_final.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
 
 
 namespace boost { namespace hana { namespace detail {
-    template <detail::std::size_t n, typename Xn>
+    template <typename ...Xs>
+    struct closure_impl;
+
+    // Closures (and types derived from closures, like tuples) are detected
+    // by pattern matching instead of with a common base class. Such a base
+    // would be a subobject of every closure, and a closure stored in
+    // another one would then be padded so the two bases have distinct
+    // addresses.
+    template <typename ...Xs>
+    constexpr bool is_closure(closure_impl<Xs...> const*) { return true; }
+    constexpr bool is_closure(...) { return false; }
+
+    // Empty elements are stored as base classes to take advantage of the
+    // empty base optimization. This is not done for closures, because the
+    // elements of the outer closure would then be ambiguous with those of
+    // the inner one when they are retrieved by pattern matching.
+    template <typename Xn, bool = detail::std::is_empty<Xn>{} &&
+                                  !detail::std::is_final<Xn>{}>
+    struct use_ebo {
+        static constexpr bool value = false;
+    };
+
+    template <typename Xn>
+    struct use_ebo<Xn, true> {
+        static constexpr bool value = !detail::is_closure((Xn const*)nullptr);
+    };
+
+    template <detail::std::size_t n, typename Xn, bool = use_ebo<Xn>::value>
     struct element { Xn get; using get_type = Xn; };
 
+    // The base class is private so that the members of `Xn`, like its
+    // conversion operators or its nested `hana::datatype`, are not
+    // inherited by the closure.
+    template <detail::std::size_t n, typename Xn>
+    struct element<n, Xn, true> : private Xn {
+        using get_type = Xn;
+
+        element() = default;
+        element(element&&) = default;
+        element(element const&) = default;
+        element(element&) = default;
+
+        // Only allow implicit conversions, like for the aggregate above.
+        template <typename Y, typename = decltype(
+            detail::std::declval<void(&)(Xn)>()(detail::std::declval<Y>())
+        )>
+        constexpr element(Y&& y)
+            : Xn(static_cast<Y&&>(y))
+        { }
+
+        constexpr Xn const& base() const& { return *this; }
+        constexpr Xn& base() & { return *this; }
+        constexpr Xn&& base() && { return static_cast<Xn&&>(*this); }
+    };
+
     void swallow(...);
 
     // This type is only used for pattern matching.
@@ -80,6 +134,11 @@ namespace boost { namespace hana { namespace detail {
     //! Also note that `element<n, Xn>` is guaranteed to have a nested
     //! `get_type` alias equivalent to `Xn`, which is handy to retrieve
     //! that `Xn` without having to do pattern matching.
+    //!
+    //! Empty objects (other than closures) are stored as private base
+    //! classes of their `element`, so they take no space in the closure.
+    //! Hence, the object held by an `element` must always be accessed
+    //! with `detail::get`.
     template <typename ...Xs>
     using closure = typename make_closure_impl<
         detail::std::make_index_sequence<sizeof...(Xs)>, Xs...
@@ -89,18 +148,33 @@ namespace boost { namespace hana { namespace detail {
     //! Get the nth element of a `closure`.
     template <detail::std::size_t n, typename Xn>
     static constexpr Xn const&
-    get(element<n, Xn> const& x)
+    get(element<n, Xn, false> const& x)
     { return x.get; }
 
     template <detail::std::size_t n, typename Xn>
     static constexpr Xn&
-    get(element<n, Xn>& x)
+    get(element<n, Xn, false>& x)
     { return x.get; }
 
     template <detail::std::size_t n, typename Xn>
     static constexpr Xn&&
-    get(element<n, Xn>&& x)
-    { return static_cast<element<n, Xn>&&>(x).get; }
+    get(element<n, Xn, false>&& x)
+    { return static_cast<element<n, Xn, false>&&>(x).get; }
+
+    template <detail::std::size_t n, typename Xn>
+    static constexpr Xn const&
+    get(element<n, Xn, true> const& x)
+    { return x.base(); }
+
+    template <detail::std::size_t n, typename Xn>
+    static constexpr Xn&
+    get(element<n, Xn, true>& x)
+    { return x.base(); }
+
+    template <detail::std::size_t n, typename Xn>
+    static constexpr Xn&&
+    get(element<n, Xn, true>&& x)
+    { return static_cast<element<n, Xn, true>&&>(x).base(); }
 }}} // end namespace boost::hana::detail
 
 #endif // !BOOST_HANA_DETAIL_CLOSURE_HPP
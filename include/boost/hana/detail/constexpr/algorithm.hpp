@@ -100,7 +100,9 @@ namespace boost { namespace hana { namespace detail { namespace constexpr_ {
 
 
     template <typename BidirIter, typename BinaryPred>
-    constexpr void sort(BidirIter first, BidirIter last, BinaryPred pred) {
+    constexpr void insertion_sort(BidirIter first, BidirIter last,
+                                  BinaryPred pred)
+    {
         if (first == last) return;
 
         BidirIter i = first;
@@ -114,10 +116,259 @@ namespace boost { namespace hana { namespace detail { namespace constexpr_ {
     }
 
     template <typename BidirIter>
-    constexpr void sort(BidirIter first, BidirIter last)
+    constexpr void insertion_sort(BidirIter first, BidirIter last)
+    { insertion_sort(first, last, _ < _); }
+
+
+    template <typename RandomIter, typename BinaryPred>
+    constexpr void sift_down(RandomIter first, detail::std::size_t length,
+                             detail::std::size_t i, BinaryPred pred)
+    {
+        while (true) {
+            detail::std::size_t child = 2 * i + 1;
+            if (child >= length)
+                return;
+            if (child + 1 < length && pred(first[child], first[child + 1]))
+                ++child;
+            if (!pred(first[i], first[child]))
+                return;
+            constexpr_::swap(first[i], first[child]);
+            i = child;
+        }
+    }
+
+    template <typename RandomIter, typename BinaryPred>
+    constexpr void heap_sort(RandomIter first, RandomIter last,
+                             BinaryPred pred)
+    {
+        detail::std::size_t length = last - first;
+        for (detail::std::size_t i = length / 2; i-- > 0; )
+            constexpr_::sift_down(first, length, i, pred);
+        for (detail::std::size_t end = length; end-- > 1; ) {
+            constexpr_::swap(first[0], first[end]);
+            constexpr_::sift_down(first, end, 0, pred);
+        }
+    }
+
+    // Moves the median of `*first`, the middle element and `*(last - 1)` to
+    // `*first` and partitions `[first + 1, last)` around it. Returns the
+    // partition point; everything before it is not greater than everything
+    // after it.
+    template <typename RandomIter, typename BinaryPred>
+    constexpr RandomIter partition_pivot(RandomIter first, RandomIter last,
+                                         BinaryPred pred)
+    {
+        RandomIter a = first + 1, b = first + (last - first) / 2, c = last - 1;
+        if (pred(*a, *b)) {
+            if (pred(*b, *c))       constexpr_::swap(*first, *b);
+            else if (pred(*a, *c))  constexpr_::swap(*first, *c);
+            else                    constexpr_::swap(*first, *a);
+        }
+        else if (pred(*a, *c))      constexpr_::swap(*first, *a);
+        else if (pred(*b, *c))      constexpr_::swap(*first, *c);
+        else                        constexpr_::swap(*first, *b);
+
+        RandomIter lo = first + 1, hi = last;
+        while (true) {
+            while (lo != last && pred(*lo, *first))
+                ++lo;
+            --hi;
+            while (hi != first && pred(*first, *hi))
+                --hi;
+            if (!(lo < hi))
+                return lo;
+            constexpr_::swap(*lo, *hi);
+            ++lo;
+        }
+    }
+
+    constexpr detail::std::size_t sort_threshold = 16;
+
+    constexpr detail::std::size_t log2(detail::std::size_t n) {
+        detail::std::size_t result = 0;
+        for (; n > 1; n /= 2)
+            ++result;
+        return result;
+    }
+
+    template <typename RandomIter, typename BinaryPred>
+    constexpr void introsort_loop(RandomIter first, RandomIter last,
+                                  detail::std::size_t depth, BinaryPred pred)
+    {
+        while (static_cast<detail::std::size_t>(last - first) > sort_threshold) {
+            if (depth == 0) {
+                constexpr_::heap_sort(first, last, pred);
+                return;
+            }
+            --depth;
+            RandomIter cut = constexpr_::partition_pivot(first, last, pred);
+            constexpr_::introsort_loop(cut, last, depth, pred);
+            last = cut;
+        }
+    }
+
+    // Introsort; the ranges left unsorted by the quicksort are short, so
+    // they are finished with a single insertion sort.
+    template <typename RandomIter, typename BinaryPred>
+    constexpr void sort(RandomIter first, RandomIter last, BinaryPred pred) {
+        if (first == last) return;
+        constexpr_::introsort_loop(first, last,
+            2 * constexpr_::log2(last - first), pred);
+        constexpr_::insertion_sort(first, last, pred);
+    }
+
+    template <typename RandomIter>
+    constexpr void sort(RandomIter first, RandomIter last)
     { sort(first, last, _ < _); }
 
 
+    template <typename RandomIter, typename T, typename BinaryPred>
+    constexpr RandomIter lower_bound(RandomIter first, RandomIter last,
+                                     T const& value, BinaryPred pred)
+    {
+        auto count = last - first;
+        while (count > 0) {
+            auto step = count / 2;
+            RandomIter it = first + step;
+            if (pred(*it, value)) {
+                first = ++it;
+                count -= step + 1;
+            }
+            else count = step;
+        }
+        return first;
+    }
+
+    template <typename RandomIter, typename T>
+    constexpr RandomIter
+    lower_bound(RandomIter first, RandomIter last, T const& value)
+    { return lower_bound(first, last, value, _ < _); }
+
+    template <typename RandomIter, typename T, typename BinaryPred>
+    constexpr RandomIter upper_bound(RandomIter first, RandomIter last,
+                                     T const& value, BinaryPred pred)
+    {
+        auto count = last - first;
+        while (count > 0) {
+            auto step = count / 2;
+            RandomIter it = first + step;
+            if (!pred(value, *it)) {
+                first = ++it;
+                count -= step + 1;
+            }
+            else count = step;
+        }
+        return first;
+    }
+
+    template <typename RandomIter, typename T>
+    constexpr RandomIter
+    upper_bound(RandomIter first, RandomIter last, T const& value)
+    { return upper_bound(first, last, value, _ < _); }
+
+
+    template <typename RandomIter>
+    constexpr RandomIter rotate(RandomIter first, RandomIter middle,
+                                RandomIter last)
+    {
+        constexpr_::reverse(first, middle);
+        constexpr_::reverse(middle, last);
+        constexpr_::reverse(first, last);
+        return first + (last - middle);
+    }
+
+    // Merges without a buffer, which can't be allocated in a constexpr
+    // function.
+    template <typename RandomIter, typename BinaryPred>
+    constexpr void inplace_merge(RandomIter first, RandomIter middle,
+                                 RandomIter last, BinaryPred pred)
+    {
+        auto len1 = middle - first, len2 = last - middle;
+        if (len1 == 0 || len2 == 0)
+            return;
+        if (len1 + len2 == 2) {
+            if (pred(*middle, *first))
+                constexpr_::swap(*first, *middle);
+            return;
+        }
+
+        RandomIter cut1 = first, cut2 = middle;
+        if (len1 > len2) {
+            cut1 += len1 / 2;
+            cut2 = constexpr_::lower_bound(middle, last, *cut1, pred);
+        }
+        else {
+            cut2 += len2 / 2;
+            cut1 = constexpr_::upper_bound(first, middle, *cut2, pred);
+        }
+        RandomIter new_middle = constexpr_::rotate(cut1, middle, cut2);
+        constexpr_::inplace_merge(first, cut1, new_middle, pred);
+        constexpr_::inplace_merge(new_middle, cut2, last, pred);
+    }
+
+    template <typename RandomIter, typename BinaryPred>
+    constexpr void stable_sort(RandomIter first, RandomIter last,
+                               BinaryPred pred)
+    {
+        if (static_cast<detail::std::size_t>(last - first) <= sort_threshold) {
+            constexpr_::insertion_sort(first, last, pred);
+            return;
+        }
+        RandomIter middle = first + (last - first) / 2;
+        constexpr_::stable_sort(first, middle, pred);
+        constexpr_::stable_sort(middle, last, pred);
+        constexpr_::inplace_merge(first, middle, last, pred);
+    }
+
+    template <typename RandomIter>
+    constexpr void stable_sort(RandomIter first, RandomIter last)
+    { stable_sort(first, last, _ < _); }
+
+
+    template <typename RandomIter, typename BinaryPred>
+    constexpr void nth_element(RandomIter first, RandomIter nth,
+                               RandomIter last, BinaryPred pred)
+    {
+        if (nth == last) return;
+        detail::std::size_t depth = 2 * constexpr_::log2(last - first);
+        while (static_cast<detail::std::size_t>(last - first) > sort_threshold) {
+            if (depth-- == 0) {
+                constexpr_::heap_sort(first, last, pred);
+                return;
+            }
+            RandomIter cut = constexpr_::partition_pivot(first, last, pred);
+            if (cut <= nth)
+                first = cut;
+            else
+                last = cut;
+        }
+        constexpr_::insertion_sort(first, last, pred);
+    }
+
+    template <typename RandomIter>
+    constexpr void nth_element(RandomIter first, RandomIter nth, RandomIter last)
+    { nth_element(first, nth, last, _ < _); }
+
+
+    template <typename ForwardIter, typename BinaryPred>
+    constexpr ForwardIter unique(ForwardIter first, ForwardIter last,
+                                 BinaryPred pred)
+    {
+        if (first == last)
+            return last;
+
+        ForwardIter result = first;
+        while (++first != last)
+            if (!pred(*result, *first) && ++result != first)
+                *result = detail::std::move(*first);
+        return ++result;
+    }
+
+    template <typename ForwardIter>
+    constexpr ForwardIter unique(ForwardIter first, ForwardIter last)
+    { return unique(first, last, _ == _); }
+
+
     template <typename InputIter, typename T>
     constexpr InputIter find(InputIter first, InputIter last, T const& value) {
         for (; first != last; ++first)
@@ -151,6 +402,51 @@ namespace boost { namespace hana { namespace detail { namespace constexpr_ {
                 ++n;
         return n;
     }
+
+    template <typename InputIter, typename T, typename BinaryOp>
+    constexpr T accumulate(InputIter first, InputIter last, T init,
+                           BinaryOp op)
+    {
+        for (; first != last; ++first)
+            init = op(detail::std::move(init), *first);
+        return init;
+    }
+
+    template <typename ForwardIter, typename BinaryPred>
+    constexpr ForwardIter max_element(ForwardIter first, ForwardIter last,
+                                      BinaryPred pred)
+    {
+        if (first == last)
+            return last;
+
+        ForwardIter largest = first;
+        while (++first != last)
+            if (pred(*largest, *first))
+                largest = first;
+        return largest;
+    }
+
+    template <typename ForwardIter>
+    constexpr ForwardIter max_element(ForwardIter first, ForwardIter last)
+    { return max_element(first, last, _ < _); }
+
+    template <typename ForwardIter, typename BinaryPred>
+    constexpr ForwardIter min_element(ForwardIter first, ForwardIter last,
+                                      BinaryPred pred)
+    {
+        if (first == last)
+            return last;
+
+        ForwardIter smallest = first;
+        while (++first != last)
+            if (pred(*first, *smallest))
+                smallest = first;
+        return smallest;
+    }
+
+    template <typename ForwardIter>
+    constexpr ForwardIter min_element(ForwardIter first, ForwardIter last)
+    { return min_element(first, last, _ < _); }
 }}}} // end namespace boost::hana::detail::constexpr_
 
 #endif // !BOOST_HANA_DETAIL_CONSTEXPR_ALGORITHM_HPP
@@ -82,6 +82,16 @@ namespace constexpr_ {
         constexpr auto sort() const
         { return this->sort(hana::_ < hana::_); }
 
+        template <typename BinaryPred>
+        constexpr auto stable_sort(BinaryPred pred) const {
+            array result = *this;
+            constexpr_::stable_sort(result.begin(), result.end(), pred);
+            return result;
+        }
+
+        constexpr auto stable_sort() const
+        { return this->stable_sort(hana::_ < hana::_); }
+
         template <typename U>
         constexpr auto iota(U value) const {
             array result = *this;
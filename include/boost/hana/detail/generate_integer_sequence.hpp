@@ -24,6 +24,19 @@ namespace boost { namespace hana { namespace detail {
         return detail::std::integer_sequence<T, sequence[i]...>{};
     }
 
+    template <typename T, detail::std::size_t N, typename F>
+    struct generate_integer_sequence_t {
+        using type = decltype(generate_integer_sequence_impl<T, F>(
+            detail::std::make_index_sequence<N>{}
+        ));
+    };
+
+    // Without a generator, there is no need to go through an array.
+    template <typename T, detail::std::size_t N>
+    struct generate_integer_sequence_t<T, N, decltype(id)> {
+        using type = detail::std::make_integer_sequence<T, N>;
+    };
+
     //! @ingroup group-details
     //! Generates an `integer_sequence` from an array-returning function.
     //!
@@ -39,9 +52,9 @@ namespace boost { namespace hana { namespace detail {
     //! By default, when no generator function is given,
     //! `generate_integer_sequence` is equivalent to `make_integer_sequence`.
     template <typename T, detail::std::size_t N, typename F = decltype(id)>
-    using generate_integer_sequence = decltype(generate_integer_sequence_impl<T, F>(
-        detail::std::make_index_sequence<N>{}
-    ));
+    using generate_integer_sequence = typename generate_integer_sequence_t<
+        T, N, F
+    >::type;
 
     //! @ingroup group-details
     //! Equivalent to `generate_integer_sequence<std::size_t, N, F>`.
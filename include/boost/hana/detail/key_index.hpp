@@ -0,0 +1,242 @@
+/*!
+@file
+Defines `boost::hana::detail::find_key_index` & friends.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_KEY_INDEX_HPP
+#define BOOST_HANA_DETAIL_KEY_INDEX_HPP
+
+#include <boost/hana/detail/std/conditional.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/enable_if.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/is_integral.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/type_foldl1.hpp>
+#include <boost/hana/fwd/integral_constant.hpp>
+#include <boost/hana/fwd/string.hpp>
+#include <boost/hana/fwd/type.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    // Keys whose equality is entirely determined by their type (Types,
+    // IntegralConstants and compile-time Strings) are mapped to a canonical
+    // type, such that two such keys are equal if and only if their canonical
+    // types are the same. This makes it possible to look them up through
+    // overload resolution, which requires a constant number of template
+    // instantiations, instead of comparing them one by one.
+    namespace key_index_detail {
+        template <bool negative, unsigned long long magnitude>
+        struct integral_key { };
+
+        struct no_canonical_key { };
+
+        // The canonical type is only given to the exact types of such keys,
+        // not to types deriving from them. Otherwise, any key inheriting
+        // from a Type, an IntegralConstant or a String (e.g. a Tuple storing
+        // it as a base class) would be considered equal to it.
+        template <typename Key, typename = void>
+        struct canonical_key {
+            using type = no_canonical_key;
+        };
+
+        template <typename T>
+        struct canonical_key<_type<T>> {
+            using type = _type<T>;
+        };
+
+        template <typename Key>
+        struct canonical_key<Key, typename detail::std::enable_if<
+            detail::std::is_same<
+                Key, typename _type<typename Key::type>::_
+            >::value
+        >::type> {
+            using type = _type<typename Key::type>;
+        };
+
+        // Only integral values are canonicalized; others, like pointers to
+        // members, are compared with `equal` instead.
+        template <typename T, T v>
+        struct canonical_key<_integral_constant<T, v>,
+            typename detail::std::enable_if<
+                detail::std::is_integral<T>::value
+            >::type
+        > {
+            using type = integral_key<(v < 0),
+                (v < 0 ? 0ull - static_cast<unsigned long long>(v)
+                       : static_cast<unsigned long long>(v))
+            >;
+        };
+
+        template <char ...s>
+        struct canonical_key<_string<s...>> {
+            using type = _string<s...>;
+        };
+
+        template <typename Key>
+        using canonical_key_t = typename canonical_key<
+            typename detail::std::decay<Key>::type
+        >::type;
+
+        template <bool ...>
+        struct bools;
+
+        template <typename ...Keys>
+        using all_canonical = detail::std::is_same<
+            bools<!detail::std::is_same<Keys, no_canonical_key>::value..., true>,
+            bools<true, !detail::std::is_same<Keys, no_canonical_key>::value...>
+        >;
+
+        template <typename Key, detail::std::size_t i>
+        struct index_entry { };
+
+        template <typename Indices, typename ...Keys>
+        struct index;
+
+        template <detail::std::size_t ...i, typename ...Keys>
+        struct index<detail::std::index_sequence<i...>, Keys...>
+            : index_entry<Keys, i>...
+        { };
+
+        template <typename Key, detail::std::size_t i>
+        _integral_constant<detail::std::size_t, i>
+        lookup(index_entry<Key, i> const*);
+
+        struct key_not_found { };
+        struct key_not_indexed { };
+
+        template <typename Key>
+        key_not_found lookup(...);
+
+        template <bool canonical, typename Key, typename ...Keys>
+        struct find_key_index_impl {
+            using type = key_not_indexed;
+        };
+
+        template <typename Key, typename ...Keys>
+        struct find_key_index_impl<true, Key, Keys...> {
+            using Index = index<
+                detail::std::make_index_sequence<sizeof...(Keys)>, Keys...
+            >;
+            using type = decltype(key_index_detail::lookup<Key>(
+                static_cast<Index*>(nullptr)
+            ));
+        };
+
+        // Used to remove the duplicates from a sequence of canonical keys
+        // in a single pass. `seen` inherits from one `seen_entry` per key
+        // encountered so far, so checking whether a key was already seen
+        // is done through overload resolution.
+        template <typename Key>
+        struct seen_entry { };
+
+        template <typename ...Keys>
+        struct seen : seen_entry<Keys>... { };
+
+        template <typename Key>
+        char (&was_seen(seen_entry<Key> const*))[2];
+
+        template <typename Key>
+        char (&was_seen(...))[1];
+
+        template <typename Seen, typename Unique>
+        struct unique_state;
+
+        template <typename Key, detail::std::size_t i>
+        struct indexed_key;
+
+        template <typename State, typename X>
+        struct unique_step;
+
+        template <typename ...Seen, detail::std::size_t ...unique,
+                  typename Key, detail::std::size_t i>
+        struct unique_step<
+            unique_state<seen<Seen...>, detail::std::index_sequence<unique...>>,
+            indexed_key<Key, i>
+        > {
+            using type = typename detail::std::conditional<
+                sizeof(key_index_detail::was_seen<Key>(
+                    static_cast<seen<Seen...>*>(nullptr)
+                )) == 2,
+                unique_state<seen<Seen...>,
+                             detail::std::index_sequence<unique...>>,
+                unique_state<seen<Seen..., Key>,
+                             detail::std::index_sequence<unique..., i>>
+            >::type;
+        };
+
+        template <typename Indices, typename ...Keys>
+        struct unique_indices_impl;
+
+        template <detail::std::size_t ...i, typename ...Keys>
+        struct unique_indices_impl<detail::std::index_sequence<i...>, Keys...> {
+            using type = typename detail::type_foldl1<
+                unique_step,
+                unique_state<seen<>, detail::std::index_sequence<>>,
+                indexed_key<Keys, i>...
+            >::type;
+        };
+
+        template <typename State>
+        struct unique_indices_of;
+
+        template <typename Seen, typename Unique>
+        struct unique_indices_of<unique_state<Seen, Unique>> {
+            using type = Unique;
+        };
+    }
+
+    //! @ingroup group-details
+    //! Returns whether all the given key types have a canonical type, i.e.
+    //! whether they can be looked up with `find_key_index` and deduplicated
+    //! with `unique_key_indices`.
+    template <typename ...Keys>
+    using all_keys_canonical = key_index_detail::all_canonical<
+        key_index_detail::canonical_key_t<Keys>...
+    >;
+
+    //! @ingroup group-details
+    //! Finds the index of a key in a pack of unique keys in a constant
+    //! number of template instantiations.
+    //!
+    //! `find_key_index<Key, Keys...>::type` is
+    //! `_integral_constant<std::size_t, i>` when `Keys` contains a key equal
+    //! to `Key` at index `i`, and `key_not_found` when `Keys` contains no
+    //! such key. When the keys don't all have a canonical type, it is
+    //! `key_not_indexed`, and a linear search must be performed instead.
+    template <typename Key, typename ...Keys>
+    struct find_key_index
+        : key_index_detail::find_key_index_impl<
+            all_keys_canonical<Key, Keys...>::value,
+            key_index_detail::canonical_key_t<Key>,
+            key_index_detail::canonical_key_t<Keys>...
+        >
+    { };
+
+    template <typename Key, typename ...Keys>
+    using find_key_index_t = typename find_key_index<Key, Keys...>::type;
+
+    using key_index_detail::key_not_found;
+    using key_index_detail::key_not_indexed;
+
+    //! @ingroup group-details
+    //! Returns an `index_sequence` containing the index of the first
+    //! occurence of each key in `Keys...`, in a single pass.
+    //!
+    //! All the keys must have a canonical type, which can be checked
+    //! with `all_keys_canonical`.
+    template <typename ...Keys>
+    using unique_key_indices = typename key_index_detail::unique_indices_of<
+        typename key_index_detail::unique_indices_impl<
+            detail::std::make_index_sequence<sizeof...(Keys)>,
+            key_index_detail::canonical_key_t<Keys>...
+        >::type
+    >::type;
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_KEY_INDEX_HPP
@@ -0,0 +1,95 @@
+/*!
+@file
+Defines `boost::hana::detail::constant_results` & friends.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_PREDICATE_RESULTS_HPP
+#define BOOST_HANA_DETAIL_PREDICATE_RESULTS_HPP
+
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/detail/constexpr/algorithm.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/logical.hpp>
+
+
+namespace boost { namespace hana { namespace detail {
+    //! @ingroup group-details
+    //! The results of a predicate whose return values are Constants,
+    //! which makes it possible to compute indices from them in a
+    //! constexpr function instead of instantiating one template per
+    //! element.
+    template <bool ...b>
+    struct bools {
+        static constexpr detail::std::size_t find(bool value) {
+            constexpr bool results[sizeof...(b)+1] = {b...};
+            //                                 ^ avoid empty array
+            return detail::constexpr_::find(
+                results, results + sizeof...(b), value) - results;
+        }
+
+        static constexpr detail::std::size_t count(bool value) {
+            constexpr bool results[sizeof...(b)+1] = {b...};
+            return detail::constexpr_::count(
+                results, results + sizeof...(b), value);
+        }
+    };
+
+    //! @ingroup group-details
+    //! The results of calling a predicate of type `Pred` on objects of
+    //! type `Xs...`, all of which must be Constants.
+    template <typename Pred, typename ...Xs>
+    using predicate_results = bools<
+        hana::if_(hana::value<decltype(
+            detail::std::declval<Pred&>()(detail::std::declval<Xs>())
+        )>(), true, false)...
+    >;
+
+    struct not_constant { };
+
+    namespace predicate_results_detail {
+        template <bool constant, typename Pred, typename ...Xs>
+        struct constant_results_impl {
+            using type = not_constant;
+        };
+
+        template <typename Pred, typename ...Xs>
+        struct constant_results_impl<true, Pred, Xs...> {
+            using type = predicate_results<Pred, Xs...>;
+        };
+
+        template <typename Pred, typename X>
+        using is_constant_result = _models<Constant,
+            typename detail::std::decay<decltype(
+                detail::std::declval<Pred&>()(detail::std::declval<X>())
+            )>::type
+        >;
+    }
+
+    //! @ingroup group-details
+    //! `predicate_results<Pred, Xs...>` when the predicate returns a
+    //! Constant for every element, and `not_constant` otherwise.
+    //!
+    //! This is used by algorithms to compute their result without
+    //! recursion when possible, and to fall back to an implementation
+    //! supporting runtime results otherwise.
+    template <typename Pred, typename ...Xs>
+    using constant_results = typename predicate_results_detail::
+    constant_results_impl<
+        detail::std::is_same<
+            bools<true, predicate_results_detail::
+                        is_constant_result<Pred, Xs>::value...>,
+            bools<predicate_results_detail::
+                        is_constant_result<Pred, Xs>::value..., true>
+        >::value, Pred, Xs...
+    >::type;
+}}} // end namespace boost::hana::detail
+
+#endif // !BOOST_HANA_DETAIL_PREDICATE_RESULTS_HPP
@@ -10,6 +10,7 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_STD_DECAY_HPP
 #define BOOST_HANA_DETAIL_STD_DECAY_HPP
 
+#include <boost/hana/config.hpp>
 #include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/is_array.hpp>
 #include <boost/hana/detail/std/is_function.hpp>
@@ -18,6 +19,10 @@ Distributed under the Boost Software License, Version 1.0.
 
 
 namespace boost { namespace hana { namespace detail { namespace std {
+#if BOOST_HANA_CONFIG_HAS_BUILTIN(__decay)
+    template <typename T>
+    struct decay { using type = __decay(T); };
+#else
     template <typename T,
         typename U = typename remove_reference<T>::type,
         bool = is_array<U>::value || is_function<U>::value>
@@ -32,6 +37,7 @@ namespace boost { namespace hana { namespace detail { namespace std {
 
     template <typename T, typename U>
     struct decay<T, U, false> : remove_cv<U> { };
+#endif
 }}}} // end namespace boost::hana::detail::std
 
 #endif // !BOOST_HANA_DETAIL_STD_DECAY_HPP
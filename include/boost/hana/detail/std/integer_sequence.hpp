@@ -10,6 +10,7 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_STD_INTEGER_SEQUENCE_HPP
 #define BOOST_HANA_DETAIL_STD_INTEGER_SEQUENCE_HPP
 
+#include <boost/hana/config.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
 
 
@@ -21,6 +22,42 @@ namespace boost { namespace hana { namespace detail { namespace std {
     using index_sequence = integer_sequence<size_t, n...>;
 
 
+    // The builtins are wrapped in class templates, so that the sequences
+    // are memoized instead of being recreated each time they are used.
+#if defined(BOOST_HANA_CONFIG_HAS_BUILTIN_MAKE_INTEGER_SEQ)
+
+    namespace int_seq_detail {
+        template <typename T, T n>
+        struct make_integer_sequence {
+            using type = __make_integer_seq<integer_sequence, T, n>;
+        };
+    }
+
+    template <typename T, T n>
+    using make_integer_sequence =
+        typename int_seq_detail::make_integer_sequence<T, n>::type;
+
+    template <size_t n>
+    using make_index_sequence = make_integer_sequence<size_t, n>;
+
+#elif defined(BOOST_HANA_CONFIG_HAS_BUILTIN_INTEGER_PACK)
+
+    namespace int_seq_detail {
+        template <typename T, T n>
+        struct make_integer_sequence {
+            using type = integer_sequence<T, __integer_pack(n)...>;
+        };
+    }
+
+    template <typename T, T n>
+    using make_integer_sequence =
+        typename int_seq_detail::make_integer_sequence<T, n>::type;
+
+    template <size_t n>
+    using make_index_sequence = make_integer_sequence<size_t, n>;
+
+#else
+
     namespace int_seq_detail {
         template <typename L, typename R>
         struct concat;
@@ -68,6 +105,8 @@ namespace boost { namespace hana { namespace detail { namespace std {
     using make_index_sequence =
         typename int_seq_detail::make_index_sequence<n>::type;
 
+#endif
+
     template <typename ...T>
     using index_sequence_for = make_index_sequence<sizeof...(T)>;
 }}}} // end namespace boost::hana::detail::std
@@ -10,14 +10,20 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_STD_IS_ARRAY_HPP
 #define BOOST_HANA_DETAIL_STD_IS_ARRAY_HPP
 
+#include <boost/hana/config.hpp>
 #include <boost/hana/detail/std/integral_constant.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
 
 
 namespace boost { namespace hana { namespace detail { namespace std {
+#if BOOST_HANA_CONFIG_HAS_BUILTIN(__is_array)
+    template <typename T>
+    struct is_array : integral_constant<bool, __is_array(T)> { };
+#else
     template <typename T>           struct is_array       : false_type { };
     template <typename T>           struct is_array<T[]>  : true_type { };
     template <typename T, size_t N> struct is_array<T[N]> : true_type { };
+#endif
 }}}} // end namespace boost::hana::detail::std
 
 #endif // !BOOST_HANA_DETAIL_STD_IS_ARRAY_HPP
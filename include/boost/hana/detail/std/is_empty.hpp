@@ -0,0 +1,21 @@
+/*!
+@file
+Defines an equivalent to `std::is_empty`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_DETAIL_STD_IS_EMPTY_HPP
+#define BOOST_HANA_DETAIL_STD_IS_EMPTY_HPP
+
+#include <boost/hana/detail/std/integral_constant.hpp>
+
+
+namespace boost { namespace hana { namespace detail { namespace std {
+    template <typename T>
+    struct is_empty : integral_constant<bool, __is_empty(T)> { };
+}}}} // end namespace boost::hana::detail::std
+
+#endif // !BOOST_HANA_DETAIL_STD_IS_EMPTY_HPP
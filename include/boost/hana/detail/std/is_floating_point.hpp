@@ -10,10 +10,17 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_STD_IS_FLOATING_POINT_HPP
 #define BOOST_HANA_DETAIL_STD_IS_FLOATING_POINT_HPP
 
+#include <boost/hana/config.hpp>
 #include <boost/hana/detail/std/integral_constant.hpp>
 
 
 namespace boost { namespace hana { namespace detail { namespace std {
+#if BOOST_HANA_CONFIG_HAS_BUILTIN(__is_floating_point)
+    template <typename T>
+    struct is_floating_point
+        : integral_constant<bool, __is_floating_point(T)>
+    { };
+#else
     template <typename T> struct is_floating_point : false_type { };
     template <typename T> struct is_floating_point<T const> : is_floating_point<T> { };
     template <typename T> struct is_floating_point<T volatile> : is_floating_point<T> { };
@@ -21,6 +28,7 @@ namespace boost { namespace hana { namespace detail { namespace std {
     template <> struct is_floating_point<float> : true_type { };
     template <> struct is_floating_point<double> : true_type { };
     template <> struct is_floating_point<long double> : true_type { };
+#endif
 }}}} // end namespace boost::hana::detail::std
 
 #endif // !BOOST_HANA_DETAIL_STD_IS_FLOATING_POINT_HPP
@@ -10,10 +10,15 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_STD_IS_FUNCTION_HPP
 #define BOOST_HANA_DETAIL_STD_IS_FUNCTION_HPP
 
+#include <boost/hana/config.hpp>
 #include <boost/hana/detail/std/integral_constant.hpp>
 
 
 namespace boost { namespace hana { namespace detail { namespace std {
+#if BOOST_HANA_CONFIG_HAS_BUILTIN(__is_function)
+    template <typename T>
+    struct is_function : integral_constant<bool, __is_function(T)> { };
+#else
     template <typename F>
     struct is_function : false_type { };
 
@@ -22,6 +27,7 @@ namespace boost { namespace hana { namespace detail { namespace std {
 
     template <typename R, typename ...A>
     struct is_function<R(A..., ...)> : true_type {};
+#endif
 }}}} // end namespace boost::hana::detail::std
 
 #endif // !BOOST_HANA_DETAIL_STD_IS_FUNCTION_HPP
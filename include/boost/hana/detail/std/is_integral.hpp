@@ -10,10 +10,15 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_STD_IS_INTEGRAL_HPP
 #define BOOST_HANA_DETAIL_STD_IS_INTEGRAL_HPP
 
+#include <boost/hana/config.hpp>
 #include <boost/hana/detail/std/integral_constant.hpp>
 
 
 namespace boost { namespace hana { namespace detail { namespace std {
+#if BOOST_HANA_CONFIG_HAS_BUILTIN(__is_integral)
+    template <typename T>
+    struct is_integral : integral_constant<bool, __is_integral(T)> { };
+#else
     template <typename T> struct is_integral : false_type { };
     template <typename T> struct is_integral<T const> : is_integral<T> { };
     template <typename T> struct is_integral<T volatile> : is_integral<T> { };
@@ -33,7 +38,7 @@ namespace boost { namespace hana { namespace detail { namespace std {
     template <> struct is_integral<unsigned long>      : true_type { };
     template <> struct is_integral<long long>          : true_type { };
     template <> struct is_integral<unsigned long long> : true_type { };
-
+#endif
 
     template <typename T>
     struct is_non_boolean_integral : is_integral<T> { };
@@ -10,10 +10,17 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_STD_IS_LVALUE_REFERENCE_HPP
 #define BOOST_HANA_DETAIL_STD_IS_LVALUE_REFERENCE_HPP
 
+#include <boost/hana/config.hpp>
 #include <boost/hana/detail/std/integral_constant.hpp>
 
 
 namespace boost { namespace hana { namespace detail { namespace std {
+#if BOOST_HANA_CONFIG_HAS_BUILTIN(__is_lvalue_reference)
+    template <typename T>
+    struct is_lvalue_reference
+        : integral_constant<bool, __is_lvalue_reference(T)>
+    { };
+#else
     template <typename T>
     struct is_lvalue_reference
         : false_type
@@ -23,6 +30,7 @@ namespace boost { namespace hana { namespace detail { namespace std {
     struct is_lvalue_reference<T&>
         : true_type
     { };
+#endif
 }}}} // end namespace boost::hana::detail::std
 
 #endif // !BOOST_HANA_DETAIL_STD_IS_LVALUE_REFERENCE_HPP
@@ -10,15 +10,21 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_STD_IS_SAME_HPP
 #define BOOST_HANA_DETAIL_STD_IS_SAME_HPP
 
+#include <boost/hana/config.hpp>
 #include <boost/hana/detail/std/integral_constant.hpp>
 
 
 namespace boost { namespace hana { namespace detail { namespace std {
+#if BOOST_HANA_CONFIG_HAS_BUILTIN(__is_same)
+    template <typename T, typename U>
+    struct is_same : integral_constant<bool, __is_same(T, U)> { };
+#else
     template <typename T, typename U>
     struct is_same : false_type { };
 
     template <typename T>
     struct is_same<T, T> : true_type { };
+#endif
 }}}} // end namespace boost::hana::detail::std
 
 #endif // !BOOST_HANA_DETAIL_STD_IS_SAME_HPP
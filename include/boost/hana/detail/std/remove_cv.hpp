@@ -10,11 +10,18 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_STD_REMOVE_CV_HPP
 #define BOOST_HANA_DETAIL_STD_REMOVE_CV_HPP
 
+#include <boost/hana/config.hpp>
+
+
 namespace boost { namespace hana { namespace detail { namespace std {
+#if BOOST_HANA_CONFIG_HAS_BUILTIN(__remove_cv)
+    template <typename T> struct remove_cv { using type = __remove_cv(T); };
+#else
     template <typename T> struct remove_cv { using type = T; };
     template <typename T> struct remove_cv<T const> { using type = T; };
     template <typename T> struct remove_cv<T volatile> { using type = T; };
     template <typename T> struct remove_cv<T const volatile> { using type = T; };
+#endif
     template <typename T> using remove_cv_t = typename remove_cv<T>::type;
 }}}} // end namespace boost::hana::detail::std
 
@@ -10,10 +10,23 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_STD_REMOVE_REFERENCE_HPP
 #define BOOST_HANA_DETAIL_STD_REMOVE_REFERENCE_HPP
 
+#include <boost/hana/config.hpp>
+
+
 namespace boost { namespace hana { namespace detail { namespace std {
+    // Clang spells the builtin `__remove_reference_t`, and GCC spells it
+    // `__remove_reference`.
+#if BOOST_HANA_CONFIG_HAS_BUILTIN(__remove_reference_t)
+    template <typename T>
+    struct remove_reference { using type = __remove_reference_t(T); };
+#elif BOOST_HANA_CONFIG_HAS_BUILTIN(__remove_reference)
+    template <typename T>
+    struct remove_reference { using type = __remove_reference(T); };
+#else
     template <typename T> struct remove_reference       { using type = T; };
     template <typename T> struct remove_reference<T&>   { using type = T; };
     template <typename T> struct remove_reference<T&&>  { using type = T; };
+#endif
 }}}} // end namespace boost::hana::detail::std
 
 #endif // !BOOST_HANA_DETAIL_STD_REMOVE_REFERENCE_HPP
@@ -1,6 +1,7 @@
 /*!
 @file
-Defines `boost::hana::detail::variadic::at`.
+Defines `boost::hana::detail::variadic::at` and
+`boost::hana::detail::variadic::at_t`.
 
 @copyright Louis Dionne 2015
 Distributed under the Boost Software License, Version 1.0.
@@ -10,6 +11,8 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_DETAIL_VARIADIC_AT_HPP
 #define BOOST_HANA_DETAIL_VARIADIC_AT_HPP
 
+#include <boost/hana/config.hpp>
+#include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
 
@@ -33,6 +36,23 @@ namespace boost { namespace hana { namespace detail { namespace variadic {
 
     template <std::size_t n>
     constexpr at_type<n> at{};
+
+    //! @ingroup group-details
+    //! Returns the `n`-th type of the parameter pack `Xs...`.
+#if defined(BOOST_HANA_CONFIG_HAS_BUILTIN_TYPE_PACK_ELEMENT)
+    template <std::size_t n, typename ...Xs>
+    using at_t = __type_pack_element<n, Xs...>;
+#else
+    namespace at_detail {
+        template <typename T>
+        struct wrap { using type = T; };
+    }
+
+    template <std::size_t n, typename ...Xs>
+    using at_t = typename decltype(
+        at<n>(std::declval<at_detail::wrap<Xs>>()...)
+    )::type;
+#endif
 }}}} // end namespace boost::hana::detail::variadic
 
 #endif // !BOOST_HANA_DETAIL_VARIADIC_AT_HPP
@@ -11,21 +11,27 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_EXT_BOOST_MPL_VECTOR_HPP
 
 #include <boost/hana/comparable.hpp>
+#include <boost/hana/constant.hpp>
 #include <boost/hana/core/convert.hpp>
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/ext/boost/mpl/integral_c.hpp>
 #include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
+#include <boost/hana/random_access_iterable.hpp>
 #include <boost/hana/searchable.hpp>
 #include <boost/hana/type.hpp>
 
+#include <boost/mpl/at.hpp>
 #include <boost/mpl/empty.hpp>
 #include <boost/mpl/front.hpp>
 #include <boost/mpl/pop_front.hpp>
 #include <boost/mpl/push_front.hpp>
 #include <boost/mpl/equal.hpp>
 #include <boost/mpl/sequence_tag.hpp>
+#include <boost/mpl/size.hpp>
 #include <boost/mpl/vector.hpp>
 
 
@@ -53,7 +59,10 @@ namespace boost { namespace hana {
         //!
         //! 3. `Iterable`\n
         //! Iterating over a MPL vector is just iterating over each of the
-        //! types it contains, as if it were a `Sequence`.
+        //! types it contains, as if it were a `Sequence`. Since MPL vectors
+        //! provide random access to their elements, they also model the
+        //! `RandomAccessIterable` concept, which is used to fold and search
+        //! them without walking through them with `tail`.
         //! @snippet example/ext/boost/mpl/vector.cpp Iterable
         //!
         //! 4. `Searchable`\n
@@ -107,26 +116,38 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // Foldable
     //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<ext::boost::mpl::Vector>
+        : RandomAccessIterable::unpack_impl<ext::boost::mpl::Vector>
+    { };
+
     template <>
     struct fold_left_impl<ext::boost::mpl::Vector>
-        : Iterable::fold_left_impl<ext::boost::mpl::Vector>
+        : RandomAccessIterable::fold_left_impl<ext::boost::mpl::Vector>
     { };
 
     template <>
     struct fold_right_impl<ext::boost::mpl::Vector>
-        : Iterable::fold_right_impl<ext::boost::mpl::Vector>
+        : RandomAccessIterable::fold_right_impl<ext::boost::mpl::Vector>
     { };
 
     template <>
     struct fold_left_nostate_impl<ext::boost::mpl::Vector>
-        : Iterable::fold_left_nostate_impl<ext::boost::mpl::Vector>
+        : RandomAccessIterable::fold_left_nostate_impl<ext::boost::mpl::Vector>
     { };
 
     template <>
     struct fold_right_nostate_impl<ext::boost::mpl::Vector>
-        : Iterable::fold_right_nostate_impl<ext::boost::mpl::Vector>
+        : RandomAccessIterable::fold_right_nostate_impl<ext::boost::mpl::Vector>
     { };
 
+    template <>
+    struct length_impl<ext::boost::mpl::Vector> {
+        template <typename xs>
+        static constexpr auto apply(xs)
+        { return size_t< ::boost::mpl::size<xs>::value>; }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Iterable
     //////////////////////////////////////////////////////////////////////////
@@ -151,17 +172,31 @@ namespace boost { namespace hana {
         { return typename ::boost::mpl::empty<xs>::type{}; }
     };
 
+    template <>
+    struct at_impl<ext::boost::mpl::Vector> {
+        template <typename N, typename xs>
+        static constexpr auto apply(N const&, xs) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return type<typename ::boost::mpl::at_c<xs, n>::type>;
+        }
+    };
+
+    template <>
+    struct last_impl<ext::boost::mpl::Vector>
+        : RandomAccessIterable::last_impl<ext::boost::mpl::Vector>
+    { };
+
     //////////////////////////////////////////////////////////////////////////
     // Searchable
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct find_if_impl<ext::boost::mpl::Vector>
-        : Iterable::find_if_impl<ext::boost::mpl::Vector>
+        : RandomAccessIterable::find_if_impl<ext::boost::mpl::Vector>
     { };
 
     template <>
     struct any_of_impl<ext::boost::mpl::Vector>
-        : Iterable::any_of_impl<ext::boost::mpl::Vector>
+        : RandomAccessIterable::any_of_impl<ext::boost::mpl::Vector>
     { };
 
     //////////////////////////////////////////////////////////////////////////
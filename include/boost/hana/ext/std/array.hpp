@@ -11,12 +11,22 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_HANA_EXT_STD_ARRAY_HPP
 
 #include <boost/hana/bool.hpp>
+#include <boost/hana/constant.hpp>
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/models.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
 #include <boost/hana/detail/std/move.hpp>
 #include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/variadic/foldl1.hpp>
+#include <boost/hana/detail/variadic/foldr1.hpp>
+#include <boost/hana/detail/variadic/for_each.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/functor.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
+#include <boost/hana/random_access_iterable.hpp>
 #include <boost/hana/sequence.hpp>
 
 #include <array>
@@ -46,40 +56,197 @@ namespace boost { namespace hana {
         : Sequence::less_impl<ext::std::Array, ext::std::Array>
     { };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct transform_impl<ext::std::Array> {
+        template <typename Xs, typename F, std::size_t i0, std::size_t ...i>
+        static constexpr auto
+        transform_helper(Xs&& xs, F&& f, detail::std::index_sequence<i0, i...>) {
+            using U = typename detail::std::decay<decltype(
+                f(::std::get<i0>(static_cast<Xs&&>(xs)))
+            )>::type;
+            return ::std::array<U, sizeof...(i) + 1>{{
+                f(::std::get<i0>(static_cast<Xs&&>(xs))),
+                f(::std::get<i>(static_cast<Xs&&>(xs)))...
+            }};
+        }
+
+        template <typename Xs, typename F>
+        static constexpr auto
+        transform_helper(Xs&&, F&&, detail::std::index_sequence<>) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            using U = typename detail::std::decay<decltype(
+                detail::std::declval<F&>()(
+                    detail::std::declval<typename Raw::value_type>())
+            )>::type;
+            return ::std::array<U, 0>{};
+        }
+
+        template <typename Xs, typename F>
+        static constexpr auto apply(Xs&& xs, F&& f) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            constexpr std::size_t N = ::std::tuple_size<Raw>::value;
+            return transform_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                    detail::std::make_index_sequence<N>{});
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Foldable
+    //
+    // The elements are accessed directly with `std::get`, which forwards
+    // the elements of rvalue arrays as rvalues. This avoids going through
+    // `tail`, which copies all but the first element of the array.
     //////////////////////////////////////////////////////////////////////////
     template <>
-    struct fold_left_impl<ext::std::Array>
-        : Iterable::fold_left_impl<ext::std::Array>
-    { };
+    struct unpack_impl<ext::std::Array> {
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return static_cast<F&&>(f)(
+                ::std::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            constexpr std::size_t N = ::std::tuple_size<Raw>::value;
+            return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                 detail::std::make_index_sequence<N>{});
+        }
+    };
 
     template <>
-    struct fold_right_impl<ext::std::Array>
-        : Iterable::fold_right_impl<ext::std::Array>
-    { };
+    struct fold_left_impl<ext::std::Array> {
+        template <typename Xs, typename S, typename F, std::size_t ...i>
+        static constexpr decltype(auto)
+        fold_left_helper(Xs&& xs, S&& s, F&& f,
+                         detail::std::index_sequence<i...>)
+        {
+            return detail::variadic::foldl1(
+                static_cast<F&&>(f),
+                static_cast<S&&>(s),
+                ::std::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            constexpr std::size_t N = ::std::tuple_size<Raw>::value;
+            return fold_left_helper(
+                static_cast<Xs&&>(xs), static_cast<S&&>(s),
+                static_cast<F&&>(f), detail::std::make_index_sequence<N>{}
+            );
+        }
+    };
 
     template <>
-    struct fold_left_nostate_impl<ext::std::Array>
-        : Iterable::fold_left_nostate_impl<ext::std::Array>
-    { };
+    struct fold_right_impl<ext::std::Array> {
+        template <typename Xs, typename S, typename F, std::size_t ...i>
+        static constexpr decltype(auto)
+        fold_right_helper(Xs&& xs, S&& s, F&& f,
+                          detail::std::index_sequence<i...>)
+        {
+            return detail::variadic::foldr1(
+                static_cast<F&&>(f),
+                ::std::get<i>(static_cast<Xs&&>(xs))...,
+                static_cast<S&&>(s)
+            );
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            constexpr std::size_t N = ::std::tuple_size<Raw>::value;
+            return fold_right_helper(
+                static_cast<Xs&&>(xs), static_cast<S&&>(s),
+                static_cast<F&&>(f), detail::std::make_index_sequence<N>{}
+            );
+        }
+    };
 
     template <>
-    struct fold_right_nostate_impl<ext::std::Array>
-        : Iterable::fold_right_nostate_impl<ext::std::Array>
-    { };
+    struct fold_left_nostate_impl<ext::std::Array> {
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr decltype(auto)
+        fold_left_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return detail::variadic::foldl1(
+                static_cast<F&&>(f),
+                ::std::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            constexpr std::size_t N = ::std::tuple_size<Raw>::value;
+            return fold_left_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                    detail::std::make_index_sequence<N>{});
+        }
+    };
+
+    template <>
+    struct fold_right_nostate_impl<ext::std::Array> {
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr decltype(auto)
+        fold_right_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return detail::variadic::foldr1(
+                static_cast<F&&>(f),
+                ::std::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            constexpr std::size_t N = ::std::tuple_size<Raw>::value;
+            return fold_right_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                     detail::std::make_index_sequence<N>{});
+        }
+    };
+
+    template <>
+    struct for_each_impl<ext::std::Array> {
+        template <typename Xs, typename F, std::size_t ...i>
+        static constexpr void
+        for_each_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            detail::variadic::for_each(
+                static_cast<F&&>(f),
+                ::std::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr void apply(Xs&& xs, F&& f) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            constexpr std::size_t N = ::std::tuple_size<Raw>::value;
+            for_each_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                            detail::std::make_index_sequence<N>{});
+        }
+    };
+
+    template <>
+    struct length_impl<ext::std::Array> {
+        template <typename T, std::size_t N>
+        static constexpr auto apply(::std::array<T, N> const&)
+        { return size_t<N>; }
+    };
 
     //////////////////////////////////////////////////////////////////////////
     // Searchable
     //////////////////////////////////////////////////////////////////////////
     template <>
     struct find_if_impl<ext::std::Array>
-        : Iterable::find_if_impl<ext::std::Array>
+        : RandomAccessIterable::find_if_impl<ext::std::Array>
     { };
 
     template <>
     struct any_of_impl<ext::std::Array>
-        : Iterable::any_of_impl<ext::std::Array>
+        : RandomAccessIterable::any_of_impl<ext::std::Array>
     { };
 
     //////////////////////////////////////////////////////////////////////////
@@ -127,6 +294,49 @@ namespace boost { namespace hana {
         static constexpr auto apply(::std::array<T, N> const&)
         { return bool_<N == 0>; }
     };
+
+    template <>
+    struct at_impl<ext::std::Array> {
+        template <typename I, typename T, std::size_t n>
+        static constexpr T const& apply(I const&, ::std::array<T, n> const& xs)
+        { return xs[hana::value<I>()]; }
+
+        template <typename I, typename T, std::size_t n>
+        static constexpr T& apply(I const&, ::std::array<T, n>& xs)
+        { return xs[hana::value<I>()]; }
+
+        template <typename I, typename T, std::size_t n>
+        static constexpr T apply(I const&, ::std::array<T, n>&& xs)
+        { return detail::std::move(xs[hana::value<I>()]); }
+    };
+
+    template <>
+    struct last_impl<ext::std::Array>
+        : RandomAccessIterable::last_impl<ext::std::Array>
+    { };
+
+    template <>
+    struct drop_at_most_impl<ext::std::Array> {
+        template <typename T, std::size_t n, typename Xs, std::size_t ...index>
+        static constexpr auto drop_helper(Xs&& xs, detail::std::index_sequence<index...>) {
+            return ::std::array<T, sizeof...(index)>{{
+                static_cast<Xs&&>(xs)[n + index]...
+            }};
+        }
+
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N const&, Xs&& xs) {
+            using RawArray = typename detail::std::remove_reference<Xs>::type;
+            constexpr std::size_t n = hana::value<N>();
+            constexpr auto size = ::std::tuple_size<RawArray>::value;
+            constexpr std::size_t drop_size = n > size ? size : n;
+            using T = typename RawArray::value_type;
+            return drop_helper<T, drop_size>(
+                static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<size - drop_size>{}
+            );
+        }
+    };
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_EXT_STD_ARRAY_HPP
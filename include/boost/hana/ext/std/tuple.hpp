@@ -19,10 +19,17 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/detail/std/integer_sequence.hpp>
 #include <boost/hana/detail/std/remove_reference.hpp>
 #include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/variadic/foldl1.hpp>
+#include <boost/hana/detail/variadic/foldr1.hpp>
+#include <boost/hana/detail/variadic/for_each.hpp>
+#include <boost/hana/foldable.hpp>
 #include <boost/hana/functor.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/monad.hpp>
 #include <boost/hana/monad_plus.hpp>
+#include <boost/hana/random_access_iterable.hpp>
+#include <boost/hana/searchable.hpp>
 #include <boost/hana/sequence.hpp>
 
 #include <tuple>
@@ -138,6 +145,162 @@ namespace boost { namespace hana {
         { return ::std::tuple<>{}; }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //
+    // The elements are accessed directly with `std::get`, which forwards
+    // the elements of rvalue tuples as rvalues. This avoids going through
+    // `tail`, which copies all but the first element of the tuple.
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct unpack_impl<ext::std::Tuple> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return static_cast<F&&>(f)(
+                ::std::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            constexpr detail::std::size_t N = ::std::tuple_size<Raw>::value;
+            return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                 detail::std::make_index_sequence<N>{});
+        }
+    };
+
+    template <>
+    struct fold_left_impl<ext::std::Tuple> {
+        template <typename Xs, typename S, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        fold_left_helper(Xs&& xs, S&& s, F&& f,
+                         detail::std::index_sequence<i...>)
+        {
+            return detail::variadic::foldl1(
+                static_cast<F&&>(f),
+                static_cast<S&&>(s),
+                ::std::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            constexpr detail::std::size_t N = ::std::tuple_size<Raw>::value;
+            return fold_left_helper(
+                static_cast<Xs&&>(xs), static_cast<S&&>(s),
+                static_cast<F&&>(f), detail::std::make_index_sequence<N>{}
+            );
+        }
+    };
+
+    template <>
+    struct fold_right_impl<ext::std::Tuple> {
+        template <typename Xs, typename S, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        fold_right_helper(Xs&& xs, S&& s, F&& f,
+                          detail::std::index_sequence<i...>)
+        {
+            return detail::variadic::foldr1(
+                static_cast<F&&>(f),
+                ::std::get<i>(static_cast<Xs&&>(xs))...,
+                static_cast<S&&>(s)
+            );
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            constexpr detail::std::size_t N = ::std::tuple_size<Raw>::value;
+            return fold_right_helper(
+                static_cast<Xs&&>(xs), static_cast<S&&>(s),
+                static_cast<F&&>(f), detail::std::make_index_sequence<N>{}
+            );
+        }
+    };
+
+    template <>
+    struct fold_left_nostate_impl<ext::std::Tuple> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        fold_left_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return detail::variadic::foldl1(
+                static_cast<F&&>(f),
+                ::std::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            constexpr detail::std::size_t N = ::std::tuple_size<Raw>::value;
+            return fold_left_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                    detail::std::make_index_sequence<N>{});
+        }
+    };
+
+    template <>
+    struct fold_right_nostate_impl<ext::std::Tuple> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        fold_right_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return detail::variadic::foldr1(
+                static_cast<F&&>(f),
+                ::std::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            constexpr detail::std::size_t N = ::std::tuple_size<Raw>::value;
+            return fold_right_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                     detail::std::make_index_sequence<N>{});
+        }
+    };
+
+    template <>
+    struct for_each_impl<ext::std::Tuple> {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr void
+        for_each_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            detail::variadic::for_each(
+                static_cast<F&&>(f),
+                ::std::get<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr void apply(Xs&& xs, F&& f) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            constexpr detail::std::size_t N = ::std::tuple_size<Raw>::value;
+            for_each_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                            detail::std::make_index_sequence<N>{});
+        }
+    };
+
+    template <>
+    struct length_impl<ext::std::Tuple> {
+        template <typename ...Xs>
+        static constexpr auto apply(::std::tuple<Xs...> const&)
+        { return size_t<sizeof...(Xs)>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct find_if_impl<ext::std::Tuple>
+        : RandomAccessIterable::find_if_impl<ext::std::Tuple>
+    { };
+
+    template <>
+    struct any_of_impl<ext::std::Tuple>
+        : RandomAccessIterable::any_of_impl<ext::std::Tuple>
+    { };
+
     //////////////////////////////////////////////////////////////////////////
     // Iterable
     //////////////////////////////////////////////////////////////////////////
@@ -186,6 +349,34 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct last_impl<ext::std::Tuple>
+        : RandomAccessIterable::last_impl<ext::std::Tuple>
+    { };
+
+    template <>
+    struct drop_at_most_impl<ext::std::Tuple> {
+        template <detail::std::size_t n, typename Xs, detail::std::size_t ...index>
+        static constexpr decltype(auto)
+        drop_helper(Xs&& xs, detail::std::index_sequence<index...>) {
+            return ::std::make_tuple(
+                ::std::get<n + index>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N const&, Xs&& xs) {
+            using Raw = typename detail::std::remove_reference<Xs>::type;
+            constexpr detail::std::size_t n = hana::value<N>();
+            constexpr detail::std::size_t size = ::std::tuple_size<Raw>::value;
+            constexpr detail::std::size_t drop_size = n > size ? size : n;
+            return drop_helper<drop_size>(
+                static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<size - drop_size>{}
+            );
+        }
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Sequence
     //////////////////////////////////////////////////////////////////////////
@@ -13,6 +13,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/comparable.hpp>
 #include <boost/hana/core/datatype.hpp>
+#include <boost/hana/foldable.hpp>
 #include <boost/hana/functor.hpp>
 #include <boost/hana/orderable.hpp>
 
@@ -62,7 +63,6 @@ namespace boost { namespace hana {
         }
     };
 
-#if 0
     //////////////////////////////////////////////////////////////////////////
     // Functor
     //////////////////////////////////////////////////////////////////////////
@@ -89,7 +89,7 @@ namespace boost { namespace hana {
                 std::is_same<
                     T,
                     std::remove_cv_t<std::remove_reference_t<
-                        decltype(f(*v.begin()))
+                        decltype(f(std::move(*v.begin())))
                     >>
                 >{}
                 , std::vector<T, Alloc>
@@ -104,7 +104,84 @@ namespace boost { namespace hana {
             return std::move(v);
         }
     };
-#endif
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //
+    // The size of a `std::vector` is only known at runtime, so these are
+    // implemented with plain loops. The type of the state is the type
+    // returned by the function when it is called with the initial state
+    // and an element of the vector.
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct fold_left_impl<ext::std::Vector> {
+        template <typename V, typename S, typename F>
+        static auto apply(V&& v, S&& s, F&& f) {
+            using State = std::decay_t<decltype(
+                f(std::forward<S>(s), *v.begin())
+            )>;
+            State state(std::forward<S>(s));
+            for (auto&& x : v)
+                state = f(std::move(state), x);
+            return state;
+        }
+    };
+
+    template <>
+    struct fold_right_impl<ext::std::Vector> {
+        template <typename V, typename S, typename F>
+        static auto apply(V&& v, S&& s, F&& f) {
+            using State = std::decay_t<decltype(
+                f(*v.begin(), std::forward<S>(s))
+            )>;
+            State state(std::forward<S>(s));
+            for (auto it = v.rbegin(); it != v.rend(); ++it)
+                state = f(*it, std::move(state));
+            return state;
+        }
+    };
+
+    template <>
+    struct fold_left_nostate_impl<ext::std::Vector> {
+        template <typename V, typename F>
+        static auto apply(V&& v, F&& f) {
+            // The vector is required to be non-empty.
+            using State = std::decay_t<decltype(f(*v.begin(), *v.begin()))>;
+            auto it = v.begin();
+            State state(*it);
+            for (++it; it != v.end(); ++it)
+                state = f(std::move(state), *it);
+            return state;
+        }
+    };
+
+    template <>
+    struct fold_right_nostate_impl<ext::std::Vector> {
+        template <typename V, typename F>
+        static auto apply(V&& v, F&& f) {
+            // The vector is required to be non-empty.
+            using State = std::decay_t<decltype(f(*v.begin(), *v.begin()))>;
+            auto it = v.rbegin();
+            State state(*it);
+            for (++it; it != v.rend(); ++it)
+                state = f(*it, std::move(state));
+            return state;
+        }
+    };
+
+    template <>
+    struct for_each_impl<ext::std::Vector> {
+        template <typename V, typename F>
+        static void apply(V&& v, F&& f) {
+            for (auto&& x : v)
+                f(x);
+        }
+    };
+
+    // Note: `std::vector` is not made a `Searchable` nor a `MonadPlus`.
+    // `find_if` must return a `Maybe` whose type encodes whether an element
+    // was found, which can't be known at compile-time for a `std::vector`,
+    // and `empty` would need to know the type of the elements.
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_EXT_STD_VECTOR_HPP
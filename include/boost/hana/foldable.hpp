@@ -13,12 +13,16 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/foldable.hpp>
 
 #include <boost/hana/applicative.hpp>
+#include <boost/hana/core/common.hpp>
 #include <boost/hana/core/datatype.hpp>
 #include <boost/hana/core/default.hpp>
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/constexpr/algorithm.hpp>
 #include <boost/hana/detail/create.hpp>
+#include <boost/hana/detail/has_common_embedding.hpp>
 #include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/enable_if.hpp>
 #include <boost/hana/detail/std/integer_sequence.hpp>
 #include <boost/hana/detail/std/is_same.hpp>
 #include <boost/hana/detail/std/move.hpp>
@@ -567,6 +571,79 @@ namespace boost { namespace hana {
     }
     //! @endcond
 
+    //////////////////////////////////////////////////////////////////////////
+    // sum, product, minimum and maximum of IntegralConstants
+    //////////////////////////////////////////////////////////////////////////
+    namespace foldable_detail {
+        // `integral_fold<Concept, M, T>::type` is the value type of the
+        // result of combining `_integral_constant<T, v>`s with the `plus`
+        // (`Concept` is Monoid) or the `mult` (`Concept` is Ring) of `M`.
+        // It only exists when `M` is an `IntegralConstant` and these
+        // operations are defined, in which case a structure containing
+        // `_integral_constant<T, v>...` can compute its `sum` or `product`
+        // in a single constexpr evaluation, instead of creating one
+        // `_integral_constant` per intermediate result of a fold.
+        template <typename Concept, typename M, typename T, typename = void>
+        struct integral_fold { };
+
+        template <typename Concept, typename U, typename T>
+        struct integral_fold<Concept, IntegralConstant<U>, T,
+            detail::std::enable_if_t<
+                detail::std::is_same<U, T>{}
+                    ? _models<Concept, IntegralConstant<T>>{}()
+                    : detail::has_common_embedding<Concept,
+                        IntegralConstant<U>, IntegralConstant<T>>{}()
+            >
+        > {
+            using type = typename common<U, T>::type;
+        };
+
+        template <typename C>
+        struct integral_plus {
+            template <typename T>
+            constexpr C operator()(C x, T y) const
+            { return static_cast<C>(x + static_cast<C>(y)); }
+        };
+
+        template <typename C>
+        struct integral_mult {
+            template <typename T>
+            constexpr C operator()(C x, T y) const
+            { return static_cast<C>(x * static_cast<C>(y)); }
+        };
+
+        template <typename C, typename T, T ...v>
+        constexpr C integral_sum() {
+            constexpr T values[sizeof...(v)+1] = {v...};
+            //                             ^ avoid empty array
+            return detail::constexpr_::accumulate(values,
+                values + sizeof...(v), static_cast<C>(0), integral_plus<C>{});
+        }
+
+        template <typename C, typename T, T ...v>
+        constexpr C integral_product() {
+            constexpr T values[sizeof...(v)+1] = {v...};
+            return detail::constexpr_::accumulate(values,
+                values + sizeof...(v), static_cast<C>(1), integral_mult<C>{});
+        }
+
+        // The `maximum` and `minimum` of a non-empty structure containing
+        // `_integral_constant<T, v>...`, when compared with `less`.
+        template <typename T, T ...v>
+        constexpr T integral_maximum() {
+            constexpr T values[sizeof...(v)] = {v...};
+            return *detail::constexpr_::max_element(values,
+                                                    values + sizeof...(v));
+        }
+
+        template <typename T, T ...v>
+        constexpr T integral_minimum() {
+            constexpr T values[sizeof...(v)] = {v...};
+            return *detail::constexpr_::min_element(values,
+                                                    values + sizeof...(v));
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // sum
     //////////////////////////////////////////////////////////////////////////
@@ -49,19 +49,19 @@ namespace boost { namespace hana {
         template <typename F>
         constexpr decltype(auto) operator()(F&& f) const& {
             return hana::partial(static_cast<F&&>(f),
-                                 static_cast<X const&>(x).get...);
+                                 detail::get(static_cast<X const&>(x))...);
         }
 
         template <typename F>
         constexpr decltype(auto) operator()(F&& f) & {
             return hana::partial(static_cast<F&&>(f),
-                                 static_cast<X&>(x).get...);
+                                 detail::get(static_cast<X&>(x))...);
         }
 
         template <typename F>
         constexpr decltype(auto) operator()(F&& f) && {
             return hana::partial(static_cast<F&&>(f),
-                                 static_cast<X&&>(x).get...);
+                                 detail::get(static_cast<X&&>(x))...);
         }
     };
 
@@ -10,6 +10,7 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef BOOST_HANA_FUNCTIONAL_COMPOSE_HPP
 #define BOOST_HANA_FUNCTIONAL_COMPOSE_HPP
 
+#include <boost/hana/detail/closure.hpp>
 #include <boost/hana/detail/create.hpp>
 #include <boost/hana/detail/std/move.hpp>
 #include <boost/hana/detail/variadic/foldl1.hpp>
@@ -61,28 +62,35 @@ namespace boost { namespace hana {
 #else
     template <typename F, typename G>
     struct _compose {
-        F f; G g;
+        // The functions are stored in a closure so that empty functions
+        // do not take any space.
+        detail::closure<F, G> fg;
+
+        template <typename F_, typename G_>
+        constexpr _compose(F_&& f, G_&& g)
+            : fg(static_cast<F_&&>(f), static_cast<G_&&>(g))
+        { }
 
         template <typename X, typename ...Xs>
         constexpr decltype(auto) operator()(X&& x, Xs&& ...xs) const& {
-            return f(
-                g(static_cast<X&&>(x)),
+            return detail::get<0>(fg)(
+                detail::get<1>(fg)(static_cast<X&&>(x)),
                 static_cast<Xs&&>(xs)...
             );
         }
 
         template <typename X, typename ...Xs>
         constexpr decltype(auto) operator()(X&& x, Xs&& ...xs) & {
-            return f(
-                g(static_cast<X&&>(x)),
+            return detail::get<0>(fg)(
+                detail::get<1>(fg)(static_cast<X&&>(x)),
                 static_cast<Xs&&>(xs)...
             );
         }
 
         template <typename X, typename ...Xs>
         constexpr decltype(auto) operator()(X&& x, Xs&& ...xs) && {
-            return detail::std::move(f)(
-                detail::std::move(g)(static_cast<X&&>(x)),
+            return detail::get<0>(detail::std::move(fg))(
+                detail::get<1>(detail::std::move(fg))(static_cast<X&&>(x)),
                 static_cast<Xs&&>(xs)...
             );
         }
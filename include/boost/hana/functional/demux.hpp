@@ -192,18 +192,20 @@ namespace boost { namespace hana {
 
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) const& {
-            return f(static_cast<G const&>(g).get(x...)...);
+            return f(detail::get(static_cast<G const&>(g))(x...)...);
         }
 
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) & {
-            return f(static_cast<G&>(g).get(x...)...);
+            return f(detail::get(static_cast<G&>(g))(x...)...);
         }
 
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) && {
             // Not moving from G cause we would double-move.
-            return detail::std::move(f)(static_cast<G&>(g).get(x...)...);
+            return detail::std::move(f)(
+                detail::get(static_cast<G&>(g))(x...)...
+            );
         }
     };
 
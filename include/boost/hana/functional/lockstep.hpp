@@ -50,17 +50,19 @@ namespace boost { namespace hana {
 
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) const& {
-            return f(static_cast<G const&>(g).get(static_cast<X&&>(x))...);
+            return f(
+                detail::get(static_cast<G const&>(g))(static_cast<X&&>(x))...
+            );
         }
 
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) & {
-            return f(static_cast<G&>(g).get(static_cast<X&&>(x))...);
+            return f(detail::get(static_cast<G&>(g))(static_cast<X&&>(x))...);
         }
 
         template <typename ...X>
         constexpr decltype(auto) operator()(X&& ...x) && {
-            return f(static_cast<G&&>(g).get(static_cast<X&&>(x))...);
+            return f(detail::get(static_cast<G&&>(g))(static_cast<X&&>(x))...);
         }
     };
 
@@ -53,18 +53,20 @@ namespace boost { namespace hana {
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) const& {
-            return f(static_cast<X const&>(x).get..., static_cast<Y&&>(y)...);
+            return f(detail::get(static_cast<X const&>(x))...,
+                     static_cast<Y&&>(y)...);
         }
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) & {
-            return f(static_cast<X&>(x).get..., static_cast<Y&&>(y)...);
+            return f(detail::get(static_cast<X&>(x))...,
+                     static_cast<Y&&>(y)...);
         }
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) && {
             return detail::std::move(f)(
-                static_cast<X&&>(x).get..., static_cast<Y&&>(y)...
+                detail::get(static_cast<X&&>(x))..., static_cast<Y&&>(y)...
             );
         }
     };
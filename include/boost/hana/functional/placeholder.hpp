@@ -96,24 +96,37 @@ namespace boost { namespace hana {
 
             template <typename F, typename ...Z>
             constexpr auto operator()(F&& f, Z const& ...) const&
-                -> decltype(static_cast<F&&>(f)(static_cast<X const&>(
-                    detail::std::declval<detail::closure_impl<X...>>()
-                ).get...))
-            { return static_cast<F&&>(f)(static_cast<X const&>(x).get...); }
+                -> decltype(static_cast<F&&>(f)(detail::get(
+                    static_cast<X const&>(
+                        detail::std::declval<detail::closure_impl<X...>>())
+                )...))
+            {
+                return static_cast<F&&>(f)(
+                    detail::get(static_cast<X const&>(x))...
+                );
+            }
 
             template <typename F, typename ...Z>
             constexpr auto operator()(F&& f, Z const& ...) &
-                -> decltype(static_cast<F&&>(f)(static_cast<X&>(
+                -> decltype(static_cast<F&&>(f)(detail::get(static_cast<X&>(
                     detail::std::declval<detail::closure_impl<X...>&>()
-                ).get...))
-            { return static_cast<F&&>(f)(static_cast<X&>(x).get...); }
+                ))...))
+            {
+                return static_cast<F&&>(f)(
+                    detail::get(static_cast<X&>(x))...
+                );
+            }
 
             template <typename F, typename ...Z>
             constexpr auto operator()(F&& f, Z const& ...) &&
-                -> decltype(static_cast<F&&>(f)(static_cast<X&&>(
+                -> decltype(static_cast<F&&>(f)(detail::get(static_cast<X&&>(
                     detail::std::declval<detail::closure_impl<X...>>()
-                ).get...))
-            { return static_cast<F&&>(f)(static_cast<X&&>(x).get...); }
+                ))...))
+            {
+                return static_cast<F&&>(f)(
+                    detail::get(static_cast<X&&>(x))...
+                );
+            }
         };
 
         struct placeholder {
@@ -237,8 +250,8 @@ namespace boost { namespace hana {
 
             // Other (function call is a member function)
 
-#undef BOOST_HANA_PREFIX_PLACEHOLDER_OP
-#undef BOOST_HANA_BINARY_PLACEHOLDER_OP
+#undef BOOST_HANA_PLACEHOLDER_UNARY_OP
+#undef BOOST_HANA_PLACEHOLDER_BINARY_OP
     } // end namespace placeholder_detail
 
     constexpr placeholder_detail::placeholder _{};
@@ -52,18 +52,20 @@ namespace boost { namespace hana {
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) const& {
-            return f(static_cast<Y&&>(y)..., static_cast<X const&>(x).get...);
+            return f(static_cast<Y&&>(y)...,
+                     detail::get(static_cast<X const&>(x))...);
         }
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) & {
-            return f(static_cast<Y&&>(y)..., static_cast<X&>(x).get...);
+            return f(static_cast<Y&&>(y)...,
+                     detail::get(static_cast<X&>(x))...);
         }
 
         template <typename ...Y>
         constexpr decltype(auto) operator()(Y&& ...y) && {
             return detail::std::move(f)(
-                static_cast<Y&&>(y)..., static_cast<X&&>(x).get...
+                static_cast<Y&&>(y)..., detail::get(static_cast<X&&>(x))...
             );
         }
     };
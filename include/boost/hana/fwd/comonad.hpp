@@ -123,7 +123,7 @@ namespace boost { namespace hana {
         template <typename W>
         constexpr decltype(auto) operator()(W&& w) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Comonad, typename datatype<W>::type>{},
+            static_assert(_models<Comonad, typename datatype<W>::type>::value,
             "hana::extract(w) requires w to be a Comonad");
 #endif
             return extract_impl<typename datatype<W>::type>::apply(
@@ -169,7 +169,7 @@ namespace boost { namespace hana {
         template <typename W>
         constexpr decltype(auto) operator()(W&& w) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Comonad, typename datatype<W>::type>{},
+            static_assert(_models<Comonad, typename datatype<W>::type>::value,
             "hana::duplicate(w) requires w to be a Comonad");
 #endif
             return duplicate_impl<typename datatype<W>::type>::apply(
@@ -220,7 +220,7 @@ namespace boost { namespace hana {
         template <typename W, typename F>
         constexpr decltype(auto) operator()(W&& w, F&& f) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Comonad, typename datatype<W>::type>{},
+            static_assert(_models<Comonad, typename datatype<W>::type>::value,
             "hana::extend(w, f) requires w to be a Comonad");
 #endif
             return extend_impl<typename datatype<W>::type>::apply(
@@ -81,11 +81,13 @@ namespace boost { namespace hana {
     //! would be a real pain.
     //!
     //! > __Tip 1__\n
-    //! > If compile-time performance is a serious concern, consider specializing
-    //! > the `datatype` metafunction in Hana's namespace. When unspecialized,
-    //! > the metafunction has to use SFINAE, which tends to incur a larger
-    //! > compile-time overhead. For heavily used templated types, this can
-    //! > potentially make a difference.
+    //! > If compile-time performance is a serious concern, prefer a nested
+    //! > `hana::datatype` alias when the type can be modified. Such types
+    //! > are handled by a fast path which requires a single instantiation
+    //! > of `datatype`, while other types go through the `when`-based
+    //! > specializations first. For this reason, `datatype` should not be
+    //! > partially specialized for types which also have a nested
+    //! > `hana::datatype`; the nested alias should be used instead.
     //!
     //! > __Tip 2__\n
     //! > Consider using `datatype_t` alias instead of `datatype`, which
@@ -80,7 +80,7 @@ namespace boost { namespace hana {
             using Succ = succ_impl<E>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Enumerable, E>{},
+            static_assert(_models<Enumerable, E>::value,
             "hana::succ(n) requires n to be Enumerable");
         #endif
 
@@ -113,7 +113,7 @@ namespace boost { namespace hana {
             using Pred = pred_impl<E>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Enumerable, E>{},
+            static_assert(_models<Enumerable, E>::value,
             "hana::pred(n) requires n to be Enumerable");
         #endif
 
@@ -276,7 +276,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename State, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, State&& state, F&& f) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::fold.left(xs, state, f) requires xs to be Foldable");
         #endif
             return fold_left_impl<typename datatype<Xs>::type>::apply(
@@ -289,7 +289,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::fold.left(xs, f) requires xs to be Foldable");
         #endif
             return fold_left_nostate_impl<typename datatype<Xs>::type>::apply(
@@ -303,7 +303,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename State, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, State&& state, F&& f) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::fold.right(xs, state, f) requires xs to be Foldable");
         #endif
             return fold_right_impl<typename datatype<Xs>::type>::apply(
@@ -316,7 +316,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::fold.right(xs, f) requires xs to be Foldable");
         #endif
             return fold_right_nostate_impl<typename datatype<Xs>::type>::apply(
@@ -524,7 +524,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename State, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, State&& state, F&& f) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::monadic_fold<M>.left(xs, state, f) requires xs to be Foldable");
         #endif
             return monadic_fold_left_impl<typename datatype<Xs>::type>::
@@ -538,7 +538,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::monadic_fold<M>.left(xs, f) requires xs to be Foldable");
         #endif
             return monadic_fold_left_nostate_impl<typename datatype<Xs>::type>::
@@ -554,7 +554,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename State, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, State&& state, F&& f) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::monadic_fold<M>.right(xs, state, f) requires xs to be Foldable");
         #endif
             return monadic_fold_right_impl<typename datatype<Xs>::type>::
@@ -568,7 +568,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::monadic_fold<M>.right(xs, f) requires xs to be Foldable");
         #endif
             return monadic_fold_right_nostate_impl<typename datatype<Xs>::type>::
@@ -582,7 +582,7 @@ namespace boost { namespace hana {
     template <typename M>
     struct _monadic_fold : _monadic_fold_left<M> {
     #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-        static_assert(_models<Monad, M>{},
+        static_assert(_models<Monad, M>::value,
         "hana::monadic_fold<M> requires M to be a Monad");
     #endif
         static constexpr _monadic_fold_left<M> left{};
@@ -675,7 +675,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::for_each(xs, f) requires xs to be Foldable");
 #endif
             return for_each_impl<typename datatype<Xs>::type>::apply(
@@ -716,7 +716,7 @@ namespace boost { namespace hana {
         template <typename Xs>
         constexpr decltype(auto) operator()(Xs&& xs) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::length(xs) requires xs to be Foldable");
         #endif
             return length_impl<typename datatype<Xs>::type>::apply(
@@ -836,7 +836,7 @@ namespace boost { namespace hana {
         template <typename Xs>
         constexpr decltype(auto) operator()(Xs&& xs) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::minimum(xs) requires xs to be Foldable");
         #endif
             return minimum_impl<typename datatype<Xs>::type>::apply(
@@ -847,7 +847,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Predicate>
         constexpr decltype(auto) operator()(Xs&& xs, Predicate&& pred) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::minimum(xs, predicate) requires xs to be Foldable");
         #endif
             return minimum_pred_impl<typename datatype<Xs>::type>::apply(
@@ -957,7 +957,7 @@ namespace boost { namespace hana {
         template <typename Xs>
         constexpr decltype(auto) operator()(Xs&& xs) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::maximum(xs) requires xs to be Foldable");
         #endif
             return maximum_impl<typename datatype<Xs>::type>::apply(
@@ -968,7 +968,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Predicate>
         constexpr decltype(auto) operator()(Xs&& xs, Predicate&& pred) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::maximum(xs, predicate) requires xs to be Foldable");
         #endif
             return maximum_pred_impl<typename datatype<Xs>::type>::apply(
@@ -1042,14 +1042,14 @@ namespace boost { namespace hana {
     template <typename M>
     struct _sum {
     #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-        static_assert(_models<Monoid, M>{},
+        static_assert(_models<Monoid, M>::value,
         "hana::sum<M> requires M to be a Monoid");
     #endif
 
         template <typename Xs>
         constexpr decltype(auto) operator()(Xs&& xs) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::sum<M>(xs) requires xs to be Foldable");
         #endif
             return sum_impl<typename datatype<Xs>::type>::template apply<M>(
@@ -1118,14 +1118,14 @@ namespace boost { namespace hana {
     template <typename R>
     struct _product {
     #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-        static_assert(_models<Ring, R>{},
+        static_assert(_models<Ring, R>::value,
         "hana::product<R> requires R to be a Ring");
     #endif
 
         template <typename Xs>
         constexpr decltype(auto) operator()(Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::product<R>(xs) requires xs to be Foldable");
 #endif
             return product_impl<typename datatype<Xs>::type>::template apply<R>(
@@ -1178,7 +1178,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Pred>
         constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::count_if(xs, pred) requires xs to be Foldable");
 #endif
             return count_if_impl<typename datatype<Xs>::type>::apply(
@@ -1225,7 +1225,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Value>
         constexpr decltype(auto) operator()(Xs&& xs, Value&& value) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::count(xs, value) requires xs to be Foldable");
 #endif
             return count_impl<typename datatype<Xs>::type>::apply(
@@ -1282,7 +1282,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Foldable, typename datatype<Xs>::type>{},
+            static_assert(_models<Foldable, typename datatype<Xs>::type>::value,
             "hana::unpack(xs, f) requires xs to be Foldable");
 #endif
             return unpack_impl<typename datatype<Xs>::type>::apply(
@@ -166,7 +166,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Functor, typename datatype<Xs>::type>{},
+            static_assert(_models<Functor, typename datatype<Xs>::type>::value,
             "hana::transform(xs, f) requires xs to be a Functor");
 #endif
 
@@ -224,7 +224,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Pred, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred, F&& f) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Functor, typename datatype<Xs>::type>{},
+            static_assert(_models<Functor, typename datatype<Xs>::type>::value,
             "hana::adjust_if(xs, pred, f) requires xs to be a Functor");
 #endif
             return adjust_if_impl<typename datatype<Xs>::type>::apply(
@@ -283,7 +283,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Value, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, Value&& value, F&& f) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Functor, typename datatype<Xs>::type>{},
+            static_assert(_models<Functor, typename datatype<Xs>::type>::value,
             "hana::adjust(xs, value, f) requires xs to be a Functor");
 #endif
             return adjust_impl<typename datatype<Xs>::type>::apply(
@@ -341,7 +341,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Pred, typename Value>
         constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred, Value&& value) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Functor, typename datatype<Xs>::type>{},
+            static_assert(_models<Functor, typename datatype<Xs>::type>::value,
             "hana::replace_if(xs, pred, value) requires xs to be a Functor");
 #endif
             return replace_if_impl<typename datatype<Xs>::type>::apply(
@@ -396,7 +396,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename OldVal, typename NewVal>
         constexpr decltype(auto) operator()(Xs&& xs, OldVal&& oldval, NewVal&& newval) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Functor, typename datatype<Xs>::type>{},
+            static_assert(_models<Functor, typename datatype<Xs>::type>::value,
             "hana::replace(xs, oldval, newval) requires xs to be a Functor");
 #endif
             return replace_impl<typename datatype<Xs>::type>::apply(
@@ -448,7 +448,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Value>
         constexpr decltype(auto) operator()(Xs&& xs, Value&& value) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Functor, typename datatype<Xs>::type>{},
+            static_assert(_models<Functor, typename datatype<Xs>::type>::value,
             "hana::fill(xs, value) requires xs to be a Functor");
 #endif
             return fill_impl<typename datatype<Xs>::type>::apply(
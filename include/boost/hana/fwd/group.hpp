@@ -162,10 +162,10 @@ namespace boost { namespace hana {
             using Minus = minus_impl<T, U>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Group, T>{},
+            static_assert(_models<Group, T>::value,
             "hana::minus(x, y) requires x to be a Group");
 
-            static_assert(_models<Group, U>{},
+            static_assert(_models<Group, U>::value,
             "hana::minus(x, y) requires y to be a Group");
         #endif
 
@@ -197,7 +197,7 @@ namespace boost { namespace hana {
             using G = typename datatype<X>::type;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Group, G>{},
+            static_assert(_models<Group, G>::value,
             "hana::negate(x) requires x to be in a Group");
         #endif
 
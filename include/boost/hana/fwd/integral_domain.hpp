@@ -154,13 +154,13 @@ namespace boost { namespace hana {
             using Quot = quot_impl<T, U>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<IntegralDomain, T>{},
+            static_assert(_models<IntegralDomain, T>::value,
             "hana::quot(x, y) requires x to be an IntegralDomain");
 
-            static_assert(_models<IntegralDomain, U>{},
+            static_assert(_models<IntegralDomain, U>::value,
             "hana::quot(x, y) requires y to be an IntegralDomain");
 
-            static_assert(!is_default<quot_impl<T, U>>{},
+            static_assert(!is_default<quot_impl<T, U>>::value,
             "hana::quot(x, y) requires x and y to be embeddable "
             "in a common IntegralDomain");
         #endif
@@ -215,13 +215,13 @@ namespace boost { namespace hana {
             using Rem = rem_impl<T, U>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<IntegralDomain, T>{},
+            static_assert(_models<IntegralDomain, T>::value,
             "hana::rem(x, y) requires x to be an IntegralDomain");
 
-            static_assert(_models<IntegralDomain, U>{},
+            static_assert(_models<IntegralDomain, U>::value,
             "hana::rem(x, y) requires y to be an IntegralDomain");
 
-            static_assert(!is_default<rem_impl<T, U>>{},
+            static_assert(!is_default<rem_impl<T, U>>::value,
             "hana::rem(x, y) requires x and y to be embeddable "
             "in a common IntegralDomain");
         #endif
@@ -15,6 +15,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/fwd/core/datatype.hpp>
 #include <boost/hana/fwd/core/models.hpp>
 #include <boost/hana/fwd/core/operators.hpp>
+#include <boost/hana/fwd/integral_constant.hpp>
 
 
 namespace boost { namespace hana {
@@ -189,6 +190,10 @@ namespace boost { namespace hana {
     //! are implemented in an analogous way, and they are provided as
     //! `Iterable::fold_{left,right}_nostate_impl`.
     //!
+    //! When the elements of a finite `Iterable` can be accessed directly by
+    //! their index, more efficient implementations are provided by the
+    //! `RandomAccessIterable` concept.
+    //!
     //!
     //! [1]: https://github.com/ldionne/hana/issues/40
     struct Iterable {
@@ -227,7 +232,7 @@ namespace boost { namespace hana {
             using Head = head_impl<It>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Iterable, It>{},
+            static_assert(_models<Iterable, It>::value,
             "hana::head(xs) requires xs to be an Iterable");
         #endif
 
@@ -263,7 +268,7 @@ namespace boost { namespace hana {
         template <typename Xs>
         constexpr decltype(auto) operator()(Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Iterable, typename datatype<Xs>::type>{},
+            static_assert(_models<Iterable, typename datatype<Xs>::type>::value,
             "hana::tail(xs) requires xs to be an Iterable");
 #endif
             return tail_impl<typename datatype<Xs>::type>::apply(
@@ -297,7 +302,7 @@ namespace boost { namespace hana {
         template <typename Xs>
         constexpr decltype(auto) operator()(Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Iterable, typename datatype<Xs>::type>{},
+            static_assert(_models<Iterable, typename datatype<Xs>::type>::value,
             "hana::is_empty(xs) requires xs to be an Iterable");
 #endif
 
@@ -371,7 +376,7 @@ namespace boost { namespace hana {
         template <typename N, typename Xs>
         constexpr decltype(auto) operator()(N&& n, Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Iterable, typename datatype<Xs>::type>{},
+            static_assert(_models<Iterable, typename datatype<Xs>::type>::value,
             "hana::at(n, xs) requires xs to be an Iterable");
 #endif
             return at_impl<typename datatype<Xs>::type>::apply(
@@ -398,7 +403,11 @@ namespace boost { namespace hana {
     };
 #else
     template <detail::std::size_t n>
-    struct _at_c;
+    struct _at_c {
+        template <typename Xs>
+        constexpr decltype(auto) operator()(Xs&& xs) const
+        { return hana::at(size_t<n>, static_cast<Xs&&>(xs)); }
+    };
 
     template <detail::std::size_t n>
     constexpr _at_c<n> at_c{};
@@ -431,7 +440,7 @@ namespace boost { namespace hana {
         template <typename Xs>
         constexpr decltype(auto) operator()(Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Iterable, typename datatype<Xs>::type>{},
+            static_assert(_models<Iterable, typename datatype<Xs>::type>::value,
             "hana::last(xs) requires xs to be an Iterable");
 #endif
             return last_impl<typename datatype<Xs>::type>::apply(
@@ -503,7 +512,7 @@ namespace boost { namespace hana {
             using DropExactly = drop_exactly_impl<It>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Iterable, It>{},
+            static_assert(_models<Iterable, It>::value,
             "hana::drop.exactly(n, xs) requires xs to be an Iterable");
         #endif
 
@@ -518,7 +527,7 @@ namespace boost { namespace hana {
             using DropAtMost = drop_at_most_impl<It>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Iterable, It>{},
+            static_assert(_models<Iterable, It>::value,
             "hana::drop.at_most(n, xs) requires xs to be an Iterable");
         #endif
 
@@ -597,7 +606,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Pred>
         constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Iterable, typename datatype<Xs>::type>{},
+            static_assert(_models<Iterable, typename datatype<Xs>::type>::value,
             "hana::drop_while(xs, pred) requires xs to be an Iterable");
 #endif
             return drop_while_impl<typename datatype<Xs>::type>::apply(
@@ -657,7 +666,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Pred>
         constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Iterable, typename datatype<Xs>::type>{},
+            static_assert(_models<Iterable, typename datatype<Xs>::type>::value,
             "hana::drop_until(xs, pred) requires xs to be an Iterable");
 #endif
             return drop_until_impl<typename datatype<Xs>::type>::apply(
@@ -674,6 +683,37 @@ namespace boost { namespace hana {
     struct operators::of<Iterable>
         : decltype(at)
     { };
+
+    // `Iterable_ops` is defined here rather than in `iterable.hpp`, so that
+    // data types can derive from it without including the whole concept.
+    namespace operators {
+        template <typename Derived>
+        struct Iterable_ops {
+            template <typename I>
+            constexpr decltype(auto) operator[](I&& i) const& {
+                return hana::at(
+                    static_cast<I&&>(i),
+                    static_cast<Derived const&>(*this)
+                );
+            }
+
+            template <typename I>
+            constexpr decltype(auto) operator[](I&& i) & {
+                return hana::at(
+                    static_cast<I&&>(i),
+                    static_cast<Derived&>(*this)
+                );
+            }
+
+            template <typename I>
+            constexpr decltype(auto) operator[](I&& i) && {
+                return hana::at(
+                    static_cast<I&&>(i),
+                    static_cast<Derived&&>(*this)
+                );
+            }
+        };
+    }
 }} // end namespace boost::hana
 
 #endif // !BOOST_HANA_FWD_ITERABLE_HPP
@@ -205,7 +205,7 @@ namespace boost { namespace hana {
         template <typename Cond, typename Then, typename Else>
         constexpr decltype(auto) operator()(Cond&& cond, Then&& then, Else&& else_) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Logical, typename datatype<Cond>::type>{},
+            static_assert(_models<Logical, typename datatype<Cond>::type>::value,
             "hana::if_(cond, then, else) requires cond to be a Logical");
 #endif
             return if_impl<typename datatype<Cond>::type>::apply(
@@ -321,7 +321,7 @@ namespace boost { namespace hana {
         template <typename Cond, typename Then, typename Else>
         constexpr decltype(auto) operator()(Cond&& cond, Then&& then, Else&& else_) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Logical, typename datatype<Cond>::type>{},
+            static_assert(_models<Logical, typename datatype<Cond>::type>::value,
             "hana::eval_if(cond, then, else) requires cond to be a Logical");
 #endif
             return eval_if_impl<typename datatype<Cond>::type>::apply(
@@ -389,7 +389,7 @@ namespace boost { namespace hana {
             using Cond = decltype(pred(state));
 
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Logical, typename datatype<Cond>::type>{},
+            static_assert(_models<Logical, typename datatype<Cond>::type>::value,
             "hana::while_(pred, state, f) requires pred(state) to be a Logical");
 #endif
             return while_impl<typename datatype<Cond>::type>::apply(
@@ -450,7 +450,7 @@ namespace boost { namespace hana {
             using Cond = decltype(pred(state));
 
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Logical, typename datatype<Cond>::type>{},
+            static_assert(_models<Logical, typename datatype<Cond>::type>::value,
             "hana::until(pred, state, f) requires pred(state) to be a Logical");
 #endif
             return until_impl<typename datatype<Cond>::type>::apply(
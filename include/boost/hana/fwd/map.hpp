@@ -33,6 +33,10 @@ namespace boost { namespace hana {
     //! A map can be searched by its keys with a predicate yielding a
     //! compile-time `Logical`.
     //! @snippet example/map.cpp Searchable
+    //! When all the keys of the map (and the searched key) are `Type`s,
+    //! `IntegralConstant`s or compile-time `String`s, looking up a key
+    //! with `find`, `at_key` or `contains` is done in a constant number
+    //! of template instantiations. Otherwise, a linear search is performed.
     //!
     //! 3. `Foldable`\n
     //! Folding a map is equivalent to folding a list of the key/value pairs
@@ -258,7 +258,7 @@ namespace boost { namespace hana {
             using Chain = chain_impl<M>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Monad, M>{},
+            static_assert(_models<Monad, M>::value,
             "hana::chain(xs, f) requires xs to be a Monad");
         #endif
 
@@ -310,7 +310,7 @@ namespace boost { namespace hana {
             using Flatten = flatten_impl<M>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Monad, M>{},
+            static_assert(_models<Monad, M>::value,
             "hana::flatten(xs) requires xs to be a Monad");
         #endif
 
@@ -406,10 +406,10 @@ namespace boost { namespace hana {
         template <typename Before, typename Xs>
         constexpr decltype(auto) operator()(Before&& before, Xs&& xs) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Monad, typename datatype<Before>::type>{},
+            static_assert(_models<Monad, typename datatype<Before>::type>::value,
             "hana::then(before, xs) requires before to be a Monad");
 
-            static_assert(_models<Monad, typename datatype<Xs>::type>{},
+            static_assert(_models<Monad, typename datatype<Xs>::type>::value,
             "hana::then(before, xs) requires xs to be a Monad");
         #endif
 
@@ -465,7 +465,7 @@ namespace boost { namespace hana {
     template <typename M>
     struct _tap {
     #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-        static_assert(_models<Monad, M>{},
+        static_assert(_models<Monad, M>::value,
         "hana::tap<M> requires M to be a Monad");
     #endif
         template <typename F>
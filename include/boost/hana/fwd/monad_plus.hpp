@@ -119,7 +119,7 @@ namespace boost { namespace hana {
             >{},
             "hana::concat(xs, ys) requires xs and ys to have the same data type");
 
-            static_assert(_models<MonadPlus, typename datatype<Xs>::type>{},
+            static_assert(_models<MonadPlus, typename datatype<Xs>::type>::value,
             "hana::concat(xs, ys) requires xs and ys to be a MonadPlus");
 #endif
             return concat_impl<typename datatype<Xs>::type>::apply(
@@ -160,7 +160,7 @@ namespace boost { namespace hana {
     template <typename M>
     struct _empty {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-        static_assert(_models<MonadPlus, M>{},
+        static_assert(_models<MonadPlus, M>::value,
         "hana::empty<M>() requires M to be a MonadPlus");
 #endif
         constexpr decltype(auto) operator()() const {
@@ -222,7 +222,7 @@ namespace boost { namespace hana {
         template <typename X, typename Xs>
         constexpr decltype(auto) operator()(X&& x, Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<MonadPlus, typename datatype<Xs>::type>{},
+            static_assert(_models<MonadPlus, typename datatype<Xs>::type>::value,
             "hana::prepend(x, xs) requires xs to be a MonadPlus");
 #endif
             return prepend_impl<typename datatype<Xs>::type>::apply(
@@ -281,7 +281,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename X>
         constexpr decltype(auto) operator()(Xs&& xs, X&& x) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<MonadPlus, typename datatype<Xs>::type>{},
+            static_assert(_models<MonadPlus, typename datatype<Xs>::type>::value,
             "hana::append(xs, x) requires xs to be a MonadPlus");
 #endif
             return append_impl<typename datatype<Xs>::type>::apply(
@@ -357,7 +357,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Pred>
         constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<MonadPlus, typename datatype<Xs>::type>{},
+            static_assert(_models<MonadPlus, typename datatype<Xs>::type>::value,
             "hana::filter(xs, pred) requires xs to be a MonadPlus");
 #endif
             return filter_impl<typename datatype<Xs>::type>::apply(
@@ -424,7 +424,7 @@ namespace boost { namespace hana {
         template <typename N, typename Xs>
         constexpr decltype(auto) operator()(N&& n, Xs&& xs) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<MonadPlus, typename datatype<Xs>::type>{},
+            static_assert(_models<MonadPlus, typename datatype<Xs>::type>::value,
             "hana::cycle(n, xs) requires xs to be a MonadPlus");
         #endif
             return cycle_impl<typename datatype<Xs>::type>::apply(
@@ -483,7 +483,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Pred>
         constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
             #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-                static_assert(_models<MonadPlus, typename datatype<Xs>::type>{},
+                static_assert(_models<MonadPlus, typename datatype<Xs>::type>::value,
                 "hana::remove_if(xs, predicate) requires xs to be a MonadPlus");
             #endif
             return remove_if_impl<typename datatype<Xs>::type>::apply(
@@ -543,7 +543,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Value>
         constexpr decltype(auto) operator()(Xs&& xs, Value&& value) const {
             #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-                static_assert(_models<MonadPlus, typename datatype<Xs>::type>{},
+                static_assert(_models<MonadPlus, typename datatype<Xs>::type>::value,
                 "hana::remove(xs, value) requires xs to be a MonadPlus");
             #endif
             return remove_impl<typename datatype<Xs>::type>::apply(
@@ -608,7 +608,7 @@ namespace boost { namespace hana {
     template <typename M>
     struct _repeat {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-        static_assert(_models<MonadPlus, M>{},
+        static_assert(_models<MonadPlus, M>::value,
         "hana::repeat<M>(n, x) requires M to be a MonadPlus");
 #endif
         template <typename N, typename X>
@@ -671,7 +671,7 @@ namespace boost { namespace hana {
         template <typename Z, typename Xs>
         constexpr decltype(auto) operator()(Z&& z, Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<MonadPlus, typename datatype<Xs>::type>{},
+            static_assert(_models<MonadPlus, typename datatype<Xs>::type>::value,
             "hana::prefix(z, xs) requires xs to be a MonadPlus");
 #endif
             return prefix_impl<typename datatype<Xs>::type>::apply(
@@ -733,7 +733,7 @@ namespace boost { namespace hana {
         template <typename Z, typename Xs>
         constexpr decltype(auto) operator()(Z&& z, Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<MonadPlus, typename datatype<Xs>::type>{},
+            static_assert(_models<MonadPlus, typename datatype<Xs>::type>::value,
             "hana::suffix(z, xs) requires xs to be a MonadPlus");
 #endif
             return suffix_impl<typename datatype<Xs>::type>::apply(
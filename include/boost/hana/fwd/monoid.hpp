@@ -148,13 +148,13 @@ namespace boost { namespace hana {
             using Plus = plus_impl<T, U>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Monoid, T>{},
+            static_assert(_models<Monoid, T>::value,
             "hana::plus(x, y) requires x to be a Monoid");
 
-            static_assert(_models<Monoid, U>{},
+            static_assert(_models<Monoid, U>::value,
             "hana::plus(x, y) requires y to be a Monoid");
 
-            static_assert(!is_default<plus_impl<T, U>>{},
+            static_assert(!is_default<plus_impl<T, U>>::value,
             "hana::plus(x, y) requires x and y to be embeddable "
             "in a common Monoid");
         #endif
@@ -189,7 +189,7 @@ namespace boost { namespace hana {
     struct _zero {
 
     #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-        static_assert(_models<Monoid, M>{},
+        static_assert(_models<Monoid, M>::value,
         "hana::zero<M>() requires M to be a Monoid");
     #endif
 
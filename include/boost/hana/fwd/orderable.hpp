@@ -238,13 +238,13 @@ namespace boost { namespace hana {
             using Less = less_impl<T, U>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Orderable, T>{},
+            static_assert(_models<Orderable, T>::value,
             "hana::less(x, y) requires x to be Orderable");
 
-            static_assert(_models<Orderable, U>{},
+            static_assert(_models<Orderable, U>::value,
             "hana::less(x, y) requires y to be Orderable");
 
-            static_assert(!is_default<less_impl<T, U>>{},
+            static_assert(!is_default<less_impl<T, U>>::value,
             "hana::less(x, y) requires x and y to be embeddable "
             "in a common Orderable");
         #endif
@@ -297,10 +297,10 @@ namespace boost { namespace hana {
             using LessEqual = less_equal_impl<T, U>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Orderable, T>{},
+            static_assert(_models<Orderable, T>::value,
             "hana::less_equal(x, y) requires x to be Orderable");
 
-            static_assert(_models<Orderable, U>{},
+            static_assert(_models<Orderable, U>::value,
             "hana::less_equal(x, y) requires y to be Orderable");
         #endif
 
@@ -351,10 +351,10 @@ namespace boost { namespace hana {
             using Greater = greater_impl<T, U>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Orderable, T>{},
+            static_assert(_models<Orderable, T>::value,
             "hana::greater(x, y) requires x to be Orderable");
 
-            static_assert(_models<Orderable, U>{},
+            static_assert(_models<Orderable, U>::value,
             "hana::greater(x, y) requires y to be Orderable");
         #endif
 
@@ -406,10 +406,10 @@ namespace boost { namespace hana {
             using GreaterEqual = greater_equal_impl<T, U>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Orderable, T>{},
+            static_assert(_models<Orderable, T>::value,
             "hana::greater_equal(x, y) requires x to be Orderable");
 
-            static_assert(_models<Orderable, U>{},
+            static_assert(_models<Orderable, U>::value,
             "hana::greater_equal(x, y) requires y to be Orderable");
         #endif
 
@@ -459,10 +459,10 @@ namespace boost { namespace hana {
             using Min = min_impl<T, U>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Orderable, T>{},
+            static_assert(_models<Orderable, T>::value,
             "hana::min(x, y) requires x to be Orderable");
 
-            static_assert(_models<Orderable, U>{},
+            static_assert(_models<Orderable, U>::value,
             "hana::min(x, y) requires y to be Orderable");
         #endif
 
@@ -498,10 +498,10 @@ namespace boost { namespace hana {
             using Max = max_impl<T, U>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Orderable, T>{},
+            static_assert(_models<Orderable, T>::value,
             "hana::max(x, y) requires x to be Orderable");
 
-            static_assert(_models<Orderable, U>{},
+            static_assert(_models<Orderable, U>::value,
             "hana::max(x, y) requires y to be Orderable");
         #endif
 
@@ -115,7 +115,7 @@ namespace boost { namespace hana {
             using First = first_impl<P>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Product, P>{},
+            static_assert(_models<Product, P>::value,
             "hana::first(pair) requires pair to be a Product");
         #endif
 
@@ -148,7 +148,7 @@ namespace boost { namespace hana {
             using Second = second_impl<P>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Product, P>{},
+            static_assert(_models<Product, P>::value,
             "hana::second(pair) requires pair to be a Product");
         #endif
 
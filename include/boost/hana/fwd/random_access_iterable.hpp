@@ -0,0 +1,91 @@
+/*!
+@file
+Forward declares `boost::hana::RandomAccessIterable`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_FWD_RANDOM_ACCESS_ITERABLE_HPP
+#define BOOST_HANA_FWD_RANDOM_ACCESS_ITERABLE_HPP
+
+namespace boost { namespace hana {
+    //! @ingroup group-concepts
+    //! The `RandomAccessIterable` concept represents finite `Iterable`s
+    //! whose elements can be accessed directly by their index.
+    //!
+    //! The default implementations of the methods of `Iterable` are written
+    //! in terms of `head` and `tail`. For data structures where `tail`
+    //! copies the rest of the structure, this means that algorithms like
+    //! `at` and the folds perform a quadratic amount of work, both at
+    //! compile-time and at runtime. When the structure provides direct
+    //! access to its elements and its length is known at compile-time,
+    //! those algorithms can instead be implemented with an index sequence,
+    //! in a single step.
+    //!
+    //!
+    //! Minimal complete definition
+    //! ---------------------------
+    //! `at` and `length`, for an `Iterable` `It`. `length` must return a
+    //! `Constant`, and `at` must be usable with any index in `[0, length)`.
+    //! Since the provided methods call `at` once per element on the same
+    //! structure, `at` must only move out the element it returns when it
+    //! is called on an rvalue, not the whole structure.
+    //!
+    //!
+    //! Laws
+    //! ----
+    //! For any `RandomAccessIterable` `xs` with a linearization of
+    //! `[x1, ..., xn]`,
+    //! @code
+    //!     length(xs) == n
+    //!     at(i, xs) == xi+1 // for all i in [0, n)
+    //! @endcode
+    //!
+    //!
+    //! Provided methods
+    //! ----------------
+    //! Since the elements of a `RandomAccessIterable` can all be accessed at
+    //! once, the following methods are provided as
+    //! `RandomAccessIterable::xxx_impl`, and can be used by data types
+    //! modeling `RandomAccessIterable` instead of the default
+    //! implementations based on `head` and `tail`:
+    //! - From `Iterable`: `head`, `is_empty` and `last`.
+    //! - From `Foldable`: `unpack`, `fold.left` and `fold.right`, with and
+    //!   without an initial state.
+    //! - From `Searchable`: `find_if` and `any_of`.
+    //!
+    //! For example, a data type `It` defining `at`, `length` and `tail`
+    //! can be made a model of `Foldable` and `Searchable` with
+    //! @code
+    //!     template <>
+    //!     struct unpack_impl<It> : RandomAccessIterable::unpack_impl<It> { };
+    //!
+    //!     template <>
+    //!     struct find_if_impl<It> : RandomAccessIterable::find_if_impl<It> { };
+    //!
+    //!     // ...
+    //! @endcode
+    //!
+    //! `find_if` requires the predicate to return a `Constant` for every
+    //! element, like the default implementation. `any_of` also supports
+    //! predicates returning runtime results, in which case it falls back
+    //! to `Iterable::any_of_impl`.
+    struct RandomAccessIterable {
+        template <typename It> struct head_impl;
+        template <typename It> struct is_empty_impl;
+        template <typename It> struct last_impl;
+
+        template <typename It> struct unpack_impl;
+        template <typename It> struct fold_left_impl;
+        template <typename It> struct fold_right_impl;
+        template <typename It> struct fold_left_nostate_impl;
+        template <typename It> struct fold_right_nostate_impl;
+
+        template <typename It> struct find_if_impl;
+        template <typename It> struct any_of_impl;
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_FWD_RANDOM_ACCESS_ITERABLE_HPP
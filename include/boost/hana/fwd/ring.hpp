@@ -153,13 +153,13 @@ namespace boost { namespace hana {
             using Mult = mult_impl<T, U>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Ring, T>{},
+            static_assert(_models<Ring, T>::value,
             "hana::mult(x, y) requires x to be a Ring");
 
-            static_assert(_models<Ring, U>{},
+            static_assert(_models<Ring, U>::value,
             "hana::mult(x, y) requires y to be a Ring");
 
-            static_assert(!is_default<mult_impl<T, U>>{},
+            static_assert(!is_default<mult_impl<T, U>>::value,
             "hana::mult(x, y) requires x and y to be embeddable "
             "in a common Ring");
         #endif
@@ -194,7 +194,7 @@ namespace boost { namespace hana {
     struct _one {
 
     #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-        static_assert(_models<Ring, R>{},
+        static_assert(_models<Ring, R>::value,
         "hana::one<R>() requires R to be a Ring");
     #endif
 
@@ -242,7 +242,7 @@ namespace boost { namespace hana {
             using Power = power_impl<R>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Ring, R>{},
+            static_assert(_models<Ring, R>::value,
             "hana::power(x, n) requires x to be in a Ring");
         #endif
 
@@ -174,7 +174,7 @@ namespace boost { namespace hana {
             using AnyOf = any_of_impl<S>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Searchable, S>{},
+            static_assert(_models<Searchable, S>::value,
             "hana::any_of(xs, pred) requires xs to be a Searchable");
         #endif
 
@@ -211,7 +211,7 @@ namespace boost { namespace hana {
             using Any = any_impl<S>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Searchable, S>{},
+            static_assert(_models<Searchable, S>::value,
             "hana::any(xs) requires xs to be a Searchable");
         #endif
 
@@ -256,7 +256,7 @@ namespace boost { namespace hana {
             using AllOf = all_of_impl<S>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Searchable, S>{},
+            static_assert(_models<Searchable, S>::value,
             "hana::all_of(xs, pred) requires xs to be a Searchable");
         #endif
 
@@ -293,7 +293,7 @@ namespace boost { namespace hana {
             using All = all_impl<S>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Searchable, S>{},
+            static_assert(_models<Searchable, S>::value,
             "hana::all(xs) requires xs to be a Searchable");
         #endif
 
@@ -339,7 +339,7 @@ namespace boost { namespace hana {
             using NoneOf = none_of_impl<S>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Searchable, S>{},
+            static_assert(_models<Searchable, S>::value,
             "hana::none_of(xs, pred) requires xs to be a Searchable");
         #endif
 
@@ -376,7 +376,7 @@ namespace boost { namespace hana {
             using None = none_impl<S>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Searchable, S>{},
+            static_assert(_models<Searchable, S>::value,
             "hana::none(xs) requires xs to be a Searchable");
         #endif
 
@@ -426,7 +426,7 @@ namespace boost { namespace hana {
             using Contains = contains_impl<S>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Searchable, S>{}(),
+            static_assert(_models<Searchable, S>::value,
             "hana::contains(xs, key) requires xs to be a Searchable");
         #endif
 
@@ -495,7 +495,7 @@ namespace boost { namespace hana {
             using FindIf = find_if_impl<S>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Searchable, S>{}(),
+            static_assert(_models<Searchable, S>::value,
             "hana::find_if(xs, pred) requires xs to be a Searchable");
         #endif
 
@@ -546,7 +546,7 @@ namespace boost { namespace hana {
             using Find = find_impl<S>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Searchable, S>{}(),
+            static_assert(_models<Searchable, S>::value,
             "hana::find(xs, key) requires xs to be Searchable");
         #endif
 
@@ -615,7 +615,7 @@ namespace boost { namespace hana {
             using AtKey = at_key_impl<S>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Searchable, S>{}(),
+            static_assert(_models<Searchable, S>::value,
             "hana::at_key(xs, key) requires xs to be Searchable");
         #endif
 
@@ -685,13 +685,13 @@ namespace boost { namespace hana {
             using IsSubset = is_subset_impl<S1, S2>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Searchable, S1>{}(),
+            static_assert(_models<Searchable, S1>::value,
             "hana::is_subset(xs, ys) requires xs to be Searchable");
 
-            static_assert(_models<Searchable, S2>{}(),
+            static_assert(_models<Searchable, S2>::value,
             "hana::is_subset(xs, ys) requires ys to be Searchable");
 
-            static_assert(!is_default<is_subset_impl<S1, S2>>{}(),
+            static_assert(!is_default<is_subset_impl<S1, S2>>::value,
             "hana::is_subset(xs, ys) requires xs and ys to be embeddable "
             "in a common Searchable");
         #endif
@@ -303,7 +303,7 @@ namespace boost { namespace hana {
         template <typename Xs>
         constexpr decltype(auto) operator()(Xs&& xs) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::group(xs) requires xs to be a Sequence");
         #endif
             return group_impl<typename datatype<Xs>::type>::apply(
@@ -314,7 +314,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Predicate>
         constexpr decltype(auto) operator()(Xs&& xs, Predicate&& pred) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::group(xs, predicate) requires xs to be a Sequence");
         #endif
             return group_pred_impl<typename datatype<Xs>::type>::apply(
@@ -353,7 +353,7 @@ namespace boost { namespace hana {
         template <typename Xs>
         constexpr decltype(auto) operator()(Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::init(xs) requires xs to be a Sequence");
 #endif
             return init_impl<typename datatype<Xs>::type>::apply(
@@ -396,7 +396,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Z>
         constexpr decltype(auto) operator()(Xs&& xs, Z&& z) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::intersperse(xs, z) requires xs to be a Sequence");
 #endif
             return intersperse_impl<typename datatype<Xs>::type>::apply(
@@ -443,7 +443,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Pred>
         constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::partition(xs, pred) requires xs to be a Sequence");
 #endif
             return partition_impl<typename datatype<Xs>::type>::apply(
@@ -487,7 +487,7 @@ namespace boost { namespace hana {
         template <typename Xs>
         constexpr decltype(auto) operator()(Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::permutations(xs) requires xs to be a Sequence");
 #endif
             return permutations_impl<typename datatype<Xs>::type>::apply(
@@ -536,7 +536,7 @@ namespace boost { namespace hana {
         template <typename N, typename Xs>
         constexpr decltype(auto) operator()(N&& n, Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::remove_at(n, xs) requires xs to be a Sequence");
 #endif
             return remove_at_impl<typename datatype<Xs>::type>::apply(
@@ -595,7 +595,7 @@ namespace boost { namespace hana {
         template <typename Xs>
         constexpr decltype(auto) operator()(Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::reverse(xs) requires xs to be a Sequence");
 #endif
             return reverse_impl<typename datatype<Xs>::type>::apply(
@@ -766,7 +766,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename State, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, State&& state, F&& f) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::scan.left(xs, state, f) requires xs to be a Sequence");
         #endif
             return scan_left_impl<typename datatype<Xs>::type>::apply(
@@ -779,7 +779,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::scan.left(xs, f) requires xs to be a Sequence");
         #endif
             return scan_left_nostate_impl<typename datatype<Xs>::type>::apply(
@@ -793,7 +793,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename State, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, State&& state, F&& f) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::scan.right(xs, state, f) requires xs to be a Sequence");
         #endif
             return scan_right_impl<typename datatype<Xs>::type>::apply(
@@ -806,7 +806,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename F>
         constexpr decltype(auto) operator()(Xs&& xs, F&& f) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::scan.right(xs, f) requires xs to be a Sequence");
         #endif
             return scan_right_nostate_impl<typename datatype<Xs>::type>::apply(
@@ -864,7 +864,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename From, typename To>
         constexpr decltype(auto) operator()(Xs&& xs, From&& from, To&& to) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::slice(xs, from, to) requires xs to be a Sequence");
 #endif
             return slice_impl<typename datatype<Xs>::type>::apply(
@@ -1000,7 +1000,7 @@ namespace boost { namespace hana {
         template <typename Xs>
         constexpr decltype(auto) operator()(Xs&& xs) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::sort(xs) requires xs to be a Sequence");
         #endif
             return sort_impl<typename datatype<Xs>::type>::apply(
@@ -1011,7 +1011,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Predicate>
         constexpr decltype(auto) operator()(Xs&& xs, Predicate&& pred) const {
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::sort(xs, predicate) requires xs to be a Sequence");
         #endif
             return sort_pred_impl<typename datatype<Xs>::type>::apply(
@@ -1067,7 +1067,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Pred>
         constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::span(xs, pred) requires xs to be a Sequence");
 #endif
             return span_impl<typename datatype<Xs>::type>::apply(
@@ -1122,10 +1122,10 @@ namespace boost { namespace hana {
             using Subsequence = subsequence_impl<S>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, S>{},
+            static_assert(_models<Sequence, S>::value,
             "hana::subsequence(xs, indices) requires xs to be a Sequence");
 
-            static_assert(_models<Foldable, typename datatype<Indices>::type>{},
+            static_assert(_models<Foldable, typename datatype<Indices>::type>::value,
             "hana::subsequence(xs, indices) requires indices to be Foldable");
         #endif
 
@@ -1193,7 +1193,7 @@ namespace boost { namespace hana {
         template <typename N, typename Xs>
         constexpr decltype(auto) operator()(N&& n, Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::take.exactly(n, xs) requires xs to be a Sequence");
 #endif
             return take_exactly_impl<typename datatype<Xs>::type>::apply(
@@ -1209,7 +1209,7 @@ namespace boost { namespace hana {
         template <typename N, typename Xs>
         constexpr decltype(auto) operator()(N&& n, Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::take.at_most(n, xs) requires xs to be a Sequence");
 #endif
             return take_at_most_impl<typename datatype<Xs>::type>::apply(
@@ -1286,7 +1286,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Pred>
         constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::take_until(xs, pred) requires xs to be a Sequence");
 #endif
             return take_until_impl<typename datatype<Xs>::type>::apply(
@@ -1337,7 +1337,7 @@ namespace boost { namespace hana {
         template <typename Xs, typename Pred>
         constexpr decltype(auto) operator()(Xs&& xs, Pred&& pred) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::take_while(xs, pred) requires xs to be a Sequence");
 #endif
             return take_while_impl<typename datatype<Xs>::type>::apply(
@@ -1449,7 +1449,7 @@ namespace boost { namespace hana {
     template <typename S>
     struct _unfold : _unfold_left<S> {
     #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-        static_assert(_models<Sequence, S>{},
+        static_assert(_models<Sequence, S>::value,
         "hana::unfold<S> requires S to be a Sequence");
     #endif
 
@@ -1496,7 +1496,7 @@ namespace boost { namespace hana {
         template <typename Xs>
         constexpr decltype(auto) operator()(Xs&& xs) const {
 #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Sequence, typename datatype<Xs>::type>{},
+            static_assert(_models<Sequence, typename datatype<Xs>::type>::value,
             "hana::unzip(xs) requires xs to be a Sequence");
 #endif
             return unzip_impl<typename datatype<Xs>::type>::apply(
@@ -37,6 +37,9 @@ namespace boost { namespace hana {
     //! either the only element which is equal to the searched value, or
     //! `nothing`.
     //! @snippet example/set.cpp Searchable
+    //! When all the elements of the set (and the searched value) are
+    //! `Type`s, `IntegralConstant`s or compile-time `String`s, `find` and
+    //! `contains` only require a constant number of template instantiations.
     //!
     //!
     //! Conversion from any `Foldable`
@@ -49,6 +52,9 @@ namespace boost { namespace hana {
     //! @code
     //!     to<Set>(xs) == fold.left(xs, make<Set>(), insert)
     //! @endcode
+    //! However, when all the elements are `Type`s, `IntegralConstant`s or
+    //! compile-time `String`s, the duplicates are removed in a single pass
+    //! and no intermediate set is created.
     //!
     //! __Example__
     //! @snippet example/set.cpp from_Foldable
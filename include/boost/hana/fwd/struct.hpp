@@ -172,7 +172,7 @@ namespace boost { namespace hana {
     template <typename S>
     struct _accessors {
     #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-        static_assert(_models<Struct, S>{},
+        static_assert(_models<Struct, S>::value,
         "hana::accessors<S> requires S to be a Struct");
     #endif
 
@@ -209,7 +209,7 @@ namespace boost { namespace hana {
             using S = typename datatype<Object>::type;
 
             #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-                static_assert(_models<Struct, S>{},
+                static_assert(_models<Struct, S>::value,
                 "hana::members(object) requires object to be a Struct");
             #endif
 
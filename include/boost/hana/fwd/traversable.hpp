@@ -147,7 +147,7 @@ namespace boost { namespace hana {
     struct _sequence {
 
     #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-        static_assert(_models<Applicative, A>{},
+        static_assert(_models<Applicative, A>::value,
         "hana::sequence<A> requires A to be an Applicative");
     #endif
 
@@ -156,7 +156,7 @@ namespace boost { namespace hana {
             using T = typename datatype<Xs>::type;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Traversable, T>{},
+            static_assert(_models<Traversable, T>::value,
             "hana::sequence<A>(xs) requires xs to be a Traversable");
         #endif
 
@@ -210,7 +210,7 @@ namespace boost { namespace hana {
     struct _traverse {
 
     #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-        static_assert(_models<Applicative, A>{},
+        static_assert(_models<Applicative, A>::value,
         "hana::traverse<A> requires A to be an Applicative");
     #endif
 
@@ -220,7 +220,7 @@ namespace boost { namespace hana {
             using Traverse = traverse_impl<T>;
 
         #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-            static_assert(_models<Traversable, T>{},
+            static_assert(_models<Traversable, T>::value,
             "hana::traverse<A>(xs, f) requires xs to be a Traversable");
         #endif
 
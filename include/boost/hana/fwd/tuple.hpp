@@ -39,6 +39,32 @@ namespace boost { namespace hana {
     //! ------------------
     //! For convenience, operators for methods of the following concepts can
     //! be used with `Tuple`: `Comparable`, `Orderable`, `Monad`, `Iterable`.
+    //!
+    //!
+    //! Predicates
+    //! ----------
+    //! When a predicate returns compile-time `Logical`s, `find_if`, `any_of`,
+    //! `all_of`, `none_of`, `take_while`, `take_until`, `drop_while`,
+    //! `drop_until` and `span` apply it to every element of the tuple at
+    //! once, instead of stopping at the first element that decides the
+    //! result. This avoids instantiating one template per element, but it
+    //! means that the predicate must be applicable to every element of the
+    //! tuple, even past that first element. For example,
+    //! `take_while(make<Tuple>(type<char>, type<Incomplete>), pred)` with a
+    //! predicate using `sizeof` on the type fails to compile, because the
+    //! predicate is also applied to `type<Incomplete>`.
+    //!
+    //!
+    //! Headers
+    //! -------
+    //! `boost/hana/tuple.hpp` provides everything related to `Tuple`. When
+    //! only the basic operations are needed, `boost/hana/tuple/core.hpp`
+    //! can be included instead; it provides `make<Tuple>`, `at`, `head`,
+    //! `tail`, `is_empty`, `unpack`, `length`, `for_each` and the folds,
+    //! and it is much cheaper to include. The other methods of a concept
+    //! are provided for `Tuple` by the corresponding header in the
+    //! `boost/hana/tuple/` directory (e.g. `boost/hana/tuple/searchable.hpp`),
+    //! which must be included before those methods are used with tuples.
     struct Tuple { };
 
     template <typename ...Xs>
@@ -73,6 +99,9 @@ namespace boost { namespace hana {
     //! that using `tuple_t` allows the library to perform some compile-time
     //! optimizations. Also note that the type of the objects returned by
     //! `tuple_t` and an equivalent call to `make<Tuple>` may differ.
+    //! In particular, the object returned by `tuple_t` does not hold any
+    //! storage; the types are only kept in its parameter pack, and most
+    //! algorithms operate on that pack directly.
     //!
     //!
     //! Example
@@ -96,6 +125,8 @@ namespace boost { namespace hana {
     //! except that using `tuple_c` allows the library to perform some
     //! compile-time optimizations. Also note that the type of the objects
     //! returned by `tuple_c` and an equivalent call to `make<Tuple>` may differ.
+    //! Like `tuple_t`, the object returned by `tuple_c` does not hold any
+    //! storage.
     //!
     //!
     //! Example
@@ -37,38 +37,6 @@ Distributed under the Boost Software License, Version 1.0.
 
 
 namespace boost { namespace hana {
-    //////////////////////////////////////////////////////////////////////////
-    // Operators
-    //////////////////////////////////////////////////////////////////////////
-    namespace operators {
-        template <typename Derived>
-        struct Iterable_ops {
-            template <typename I>
-            constexpr decltype(auto) operator[](I&& i) const& {
-                return hana::at(
-                    static_cast<I&&>(i),
-                    static_cast<Derived const&>(*this)
-                );
-            }
-
-            template <typename I>
-            constexpr decltype(auto) operator[](I&& i) & {
-                return hana::at(
-                    static_cast<I&&>(i),
-                    static_cast<Derived&>(*this)
-                );
-            }
-
-            template <typename I>
-            constexpr decltype(auto) operator[](I&& i) && {
-                return hana::at(
-                    static_cast<I&&>(i),
-                    static_cast<Derived&&>(*this)
-                );
-            }
-        };
-    }
-
     //////////////////////////////////////////////////////////////////////////
     // head
     //////////////////////////////////////////////////////////////////////////
@@ -127,16 +95,6 @@ namespace boost { namespace hana {
         }
     };
 
-    //////////////////////////////////////////////////////////////////////////
-    // at_c
-    //////////////////////////////////////////////////////////////////////////
-    template <detail::std::size_t n>
-    struct _at_c {
-        template <typename Xs>
-        constexpr decltype(auto) operator()(Xs&& xs) const
-        { return hana::at(size_t<n>, static_cast<Xs&&>(xs)); }
-    };
-
     //////////////////////////////////////////////////////////////////////////
     // last
     //////////////////////////////////////////////////////////////////////////
@@ -150,18 +150,24 @@ namespace boost { namespace hana {
         template <typename F, typename ...Args>
         static constexpr decltype(auto)
         apply(_lazy_apply<F, detail::closure_impl<Args...>> const& expr)
-        { return expr.function(static_cast<Args const&>(expr.args).get...); }
+        {
+            return expr.function(
+                detail::get(static_cast<Args const&>(expr.args))...);
+        }
 
         template <typename F, typename ...Args>
         static constexpr decltype(auto)
         apply(_lazy_apply<F, detail::closure_impl<Args...>>& expr)
-        { return expr.function(static_cast<Args&>(expr.args).get...); }
+        {
+            return expr.function(
+                detail::get(static_cast<Args&>(expr.args))...);
+        }
 
         template <typename F, typename ...Args>
         static constexpr decltype(auto)
         apply(_lazy_apply<F, detail::closure_impl<Args...>>&& expr) {
             return detail::std::move(expr.function)(
-                                    static_cast<Args&&>(expr.args).get...);
+                        detail::get(static_cast<Args&&>(expr.args))...);
         }
 
         // _lazy_value
@@ -19,16 +19,22 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/closure.hpp>
 #include <boost/hana/detail/insert_fwd.hpp>
+#include <boost/hana/detail/key_index.hpp>
 #include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
 #include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functional/compose.hpp>
 #include <boost/hana/functional/demux.hpp>
 #include <boost/hana/functional/partial.hpp>
 #include <boost/hana/functor.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/lazy.hpp>
 #include <boost/hana/logical.hpp>
+#include <boost/hana/maybe.hpp>
 #include <boost/hana/product.hpp>
 #include <boost/hana/searchable.hpp>
 #include <boost/hana/tuple.hpp>
@@ -38,9 +44,13 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // _map
     //////////////////////////////////////////////////////////////////////////
+    // Note: `operators::adl` is not a direct base, because the pairs of the
+    // storage may have it as a base too. Two `operators::adl` subobjects
+    // can't share an address, so the _map would be padded. `Searchable_ops`
+    // is enough to make the operators visible to ADL anyway.
     template <typename ...Pairs>
-    struct _map : operators::adl, operators::Searchable_ops<_map<Pairs...>> {
-        _tuple<Pairs...> storage;
+    struct _map : operators::Searchable_ops<_map<Pairs...>> {
+        tuple_detail::basic_tuple<Pairs...> storage;
         using hana = _map;
         using datatype = Map;
 
@@ -59,6 +69,30 @@ namespace boost { namespace hana {
         : operators::of<Searchable, Comparable>
     { };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Key index
+    //
+    // Looking up a key in a map is done through `detail::find_key_index`
+    // when possible, which requires a constant number of instantiations.
+    // Otherwise, we fall back to a linear search.
+    //////////////////////////////////////////////////////////////////////////
+    namespace map_detail {
+        template <typename Map, typename Key>
+        struct find_index;
+
+        template <typename ...Pairs, typename Key>
+        struct find_index<_map<Pairs...>, Key>
+            : detail::find_key_index<Key,
+                decltype(hana::first(detail::std::declval<Pairs>()))...
+            >
+        { };
+
+        template <typename Map, typename Key>
+        using find_index_t = typename find_index<
+            typename detail::std::decay<Map>::type, Key
+        >::type;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // make<Map>
     //////////////////////////////////////////////////////////////////////////
@@ -149,6 +183,75 @@ namespace boost { namespace hana {
         }
     };
 
+    template <>
+    struct find_impl<Map> {
+        template <typename M, typename Key, detail::std::size_t i>
+        static constexpr auto find_helper(M&& map, Key&&,
+                                _integral_constant<detail::std::size_t, i>)
+        { return hana::just(hana::second(detail::get<i>(static_cast<M&&>(map).storage))); }
+
+        template <typename M, typename Key>
+        static constexpr auto find_helper(M&&, Key&&, detail::key_not_found)
+        { return nothing; }
+
+        template <typename M, typename Key>
+        static constexpr auto find_helper(M&& map, Key&& key, detail::key_not_indexed) {
+            return hana::find_if(static_cast<M&&>(map),
+                    hana::equal.to(static_cast<Key&&>(key)));
+        }
+
+        template <typename M, typename Key>
+        static constexpr auto apply(M&& map, Key&& key) {
+            return find_helper(static_cast<M&&>(map), static_cast<Key&&>(key),
+                               map_detail::find_index_t<M, Key>{});
+        }
+    };
+
+    template <>
+    struct at_key_impl<Map> {
+        template <typename M, typename Key, detail::std::size_t i>
+        static constexpr decltype(auto) at_key_helper(M&& map, Key&&,
+                                _integral_constant<detail::std::size_t, i>)
+        { return hana::second(detail::get<i>(static_cast<M&&>(map).storage)); }
+
+        template <typename M, typename Key, typename NotFound>
+        static constexpr decltype(auto) at_key_helper(M&& map, Key&& key, NotFound) {
+            return hana::from_just(hana::find(static_cast<M&&>(map),
+                                              static_cast<Key&&>(key)));
+        }
+
+        template <typename M, typename Key>
+        static constexpr decltype(auto) apply(M&& map, Key&& key) {
+            return at_key_helper(static_cast<M&&>(map), static_cast<Key&&>(key),
+                                 map_detail::find_index_t<M, Key>{});
+        }
+    };
+
+    template <>
+    struct contains_impl<Map> {
+        template <typename M, typename Key, detail::std::size_t i>
+        static constexpr auto contains_helper(M&&, Key&&,
+                                _integral_constant<detail::std::size_t, i>)
+        { return true_; }
+
+        template <typename M, typename Key>
+        static constexpr auto contains_helper(M&&, Key&&, detail::key_not_found)
+        { return false_; }
+
+        template <typename M, typename Key>
+        static constexpr auto
+        contains_helper(M&& map, Key&& key, detail::key_not_indexed) {
+            return hana::any_of(static_cast<M&&>(map),
+                    hana::equal.to(static_cast<Key&&>(key)));
+        }
+
+        template <typename M, typename Key>
+        static constexpr auto apply(M&& map, Key&& key) {
+            return contains_helper(static_cast<M&&>(map), static_cast<Key&&>(key),
+                                   map_detail::find_index_t<M, Key>{});
+        }
+    };
+
     template <>
     struct any_of_impl<Map> {
         template <typename M, typename Pred>
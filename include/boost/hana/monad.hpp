@@ -74,10 +74,9 @@ namespace boost { namespace hana {
         struct monadic_compose_helper {
             template <typename F, typename G, typename X>
             constexpr decltype(auto) operator()(F&& f, G&& g, X&& x) const {
-                using M = typename datatype<decltype(g(x))>::type;
-
             #ifdef BOOST_HANA_CONFIG_CHECK_DATA_TYPES
-                static_assert(_models<Monad, M>{},
+                using M = typename datatype<decltype(g(x))>::type;
+                static_assert(_models<Monad, M>::value,
                 "hana::monadic_compose(f, g) requires g to return a monadic value");
             #endif
 
@@ -15,6 +15,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/comparable.hpp>
 #include <boost/hana/core/make.hpp>
 #include <boost/hana/core/operators.hpp>
+#include <boost/hana/detail/closure.hpp>
 #include <boost/hana/detail/std/decay.hpp>
 #include <boost/hana/orderable.hpp>
 #include <boost/hana/product.hpp>
@@ -26,18 +27,18 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     template <typename First, typename Second>
     struct _pair : operators::adl {
-        First first;
-        Second second;
+        // The elements are stored in a closure so that empty elements
+        // do not take any space.
+        detail::closure<First, Second> storage;
 
-        constexpr _pair() : first{}, second{} { }
+        constexpr _pair() : storage() { }
 
         template <typename F, typename S, typename = decltype(
             ((void)First(detail::std::declval<F>())),
             ((void)Second(detail::std::declval<S>()))
         )>
         constexpr _pair(F&& f, S&& s)
-            : first(static_cast<F&&>(f))
-            , second(static_cast<S&&>(s))
+            : storage(static_cast<F&&>(f), static_cast<S&&>(s))
         { }
 
         using hana = _pair;
@@ -69,15 +70,15 @@ namespace boost { namespace hana {
     template <>
     struct first_impl<Pair> {
         template <typename P>
-        static constexpr decltype(auto) apply(P&& p)
-        { return static_cast<P&&>(p).first; }
+        static constexpr auto apply(P&& p)
+        { return detail::get<0>(static_cast<P&&>(p).storage); }
     };
 
     template <>
     struct second_impl<Pair> {
         template <typename P>
-        static constexpr decltype(auto) apply(P&& p)
-        { return static_cast<P&&>(p).second; }
+        static constexpr auto apply(P&& p)
+        { return detail::get<1>(static_cast<P&&>(p).storage); }
     };
 }} // end namespace boost::hana
 
@@ -0,0 +1,277 @@
+/*!
+@file
+Defines `boost::hana::RandomAccessIterable`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_RANDOM_ACCESS_ITERABLE_HPP
+#define BOOST_HANA_RANDOM_ACCESS_ITERABLE_HPP
+
+#include <boost/hana/fwd/random_access_iterable.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/default.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/variadic/foldl1.hpp>
+#include <boost/hana/detail/variadic/foldr1.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/maybe.hpp>
+#include <boost/hana/searchable.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // models
+    //////////////////////////////////////////////////////////////////////////
+    template <typename It>
+    struct models_impl<RandomAccessIterable, It>
+        : _integral_constant<bool,
+            _models<Iterable, It>{} &&
+            !is_default<at_impl<It>>{} &&
+            !is_default<length_impl<It>>{}
+        >
+    { };
+
+    namespace random_access_detail {
+        template <typename Xs>
+        using length = decltype(hana::length(detail::std::declval<Xs>()));
+
+        template <typename Xs>
+        using indices = detail::std::make_index_sequence<
+            hana::value<length<Xs>>()
+        >;
+
+        // Function object returning the `i`-th element of a structure. It
+        // is only used in unevaluated contexts, to compute the results of
+        // a predicate on every element at once.
+        template <typename Xs, typename Pred>
+        struct apply_at {
+            template <typename I>
+            auto operator()(I) const -> decltype(
+                detail::std::declval<Pred&>()(
+                    hana::at_c<I::value>(detail::std::declval<Xs>()))
+            );
+        };
+
+        template <typename Xs, typename Pred, typename Indices>
+        struct constant_results_of;
+
+        template <typename Xs, typename Pred, detail::std::size_t ...i>
+        struct constant_results_of<Xs, Pred, detail::std::index_sequence<i...>> {
+            using type = detail::constant_results<
+                apply_at<Xs, Pred>,
+                _integral_constant<detail::std::size_t, i>...
+            >;
+        };
+
+        // The results of applying `pred` to every element of `xs` when
+        // they are all Constants, and `detail::not_constant` otherwise.
+        template <typename Xs, typename Pred>
+        using constant_results = typename constant_results_of<
+            Xs, Pred, indices<Xs>
+        >::type;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Model of Iterable
+    //////////////////////////////////////////////////////////////////////////
+    template <typename It>
+    struct RandomAccessIterable::head_impl {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs)
+        { return hana::at_c<0>(static_cast<Xs&&>(xs)); }
+    };
+
+    template <typename It>
+    struct RandomAccessIterable::is_empty_impl {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&) {
+            constexpr detail::std::size_t n = hana::value<
+                random_access_detail::length<Xs const&>
+            >();
+            return bool_<n == 0>;
+        }
+    };
+
+    template <typename It>
+    struct RandomAccessIterable::last_impl {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            constexpr detail::std::size_t n = hana::value<
+                random_access_detail::length<Xs>
+            >();
+            return hana::at_c<n - 1>(static_cast<Xs&&>(xs));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Model of Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <typename It>
+    struct RandomAccessIterable::unpack_impl {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        unpack_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return static_cast<F&&>(f)(
+                hana::at_c<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return unpack_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                 random_access_detail::indices<Xs>{});
+        }
+    };
+
+    template <typename It>
+    struct RandomAccessIterable::fold_left_impl {
+        template <typename Xs, typename S, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        fold_left_helper(Xs&& xs, S&& s, F&& f,
+                         detail::std::index_sequence<i...>)
+        {
+            return detail::variadic::foldl1(
+                static_cast<F&&>(f),
+                static_cast<S&&>(s),
+                hana::at_c<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            return fold_left_helper(
+                static_cast<Xs&&>(xs), static_cast<S&&>(s),
+                static_cast<F&&>(f), random_access_detail::indices<Xs>{}
+            );
+        }
+    };
+
+    template <typename It>
+    struct RandomAccessIterable::fold_right_impl {
+        template <typename Xs, typename S, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        fold_right_helper(Xs&& xs, S&& s, F&& f,
+                          detail::std::index_sequence<i...>)
+        {
+            return detail::variadic::foldr1(
+                static_cast<F&&>(f),
+                hana::at_c<i>(static_cast<Xs&&>(xs))...,
+                static_cast<S&&>(s)
+            );
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            return fold_right_helper(
+                static_cast<Xs&&>(xs), static_cast<S&&>(s),
+                static_cast<F&&>(f), random_access_detail::indices<Xs>{}
+            );
+        }
+    };
+
+    template <typename It>
+    struct RandomAccessIterable::fold_left_nostate_impl {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        fold_left_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return detail::variadic::foldl1(
+                static_cast<F&&>(f),
+                hana::at_c<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return fold_left_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                    random_access_detail::indices<Xs>{});
+        }
+    };
+
+    template <typename It>
+    struct RandomAccessIterable::fold_right_nostate_impl {
+        template <typename Xs, typename F, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        fold_right_helper(Xs&& xs, F&& f, detail::std::index_sequence<i...>) {
+            return detail::variadic::foldr1(
+                static_cast<F&&>(f),
+                hana::at_c<i>(static_cast<Xs&&>(xs))...
+            );
+        }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return fold_right_helper(static_cast<Xs&&>(xs), static_cast<F&&>(f),
+                                     random_access_detail::indices<Xs>{});
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Model of Searchable
+    //////////////////////////////////////////////////////////////////////////
+    template <typename It>
+    struct RandomAccessIterable::find_if_impl {
+        template <detail::std::size_t index, typename Xs>
+        static constexpr auto find_helper(Xs&& xs, decltype(true_))
+        { return hana::just(hana::at_c<index>(static_cast<Xs&&>(xs))); }
+
+        template <detail::std::size_t index, typename Xs>
+        static constexpr auto find_helper(Xs&&, decltype(false_))
+        { return hana::nothing; }
+
+        template <typename Xs, typename Pred, detail::std::size_t ...i>
+        static constexpr auto
+        find_if_helper(Xs&& xs, Pred&&, detail::std::index_sequence<i...>) {
+            using Results = detail::predicate_results<
+                random_access_detail::apply_at<Xs, Pred>,
+                _integral_constant<detail::std::size_t, i>...
+            >;
+            constexpr detail::std::size_t index = Results::find(true);
+            return find_helper<index>(static_cast<Xs&&>(xs),
+                                      bool_<(index != sizeof...(i))>);
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            return find_if_helper(static_cast<Xs&&>(xs),
+                                  static_cast<Pred&&>(pred),
+                                  random_access_detail::indices<Xs>{});
+        }
+    };
+
+    template <typename It>
+    struct RandomAccessIterable::any_of_impl {
+        template <bool ...b, typename Xs, typename Pred>
+        static constexpr auto
+        any_of_helper(detail::bools<b...>, Xs&&, Pred&&) {
+            return bool_<(detail::bools<b...>::find(true) != sizeof...(b))>;
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto
+        any_of_helper(detail::not_constant, Xs&& xs, Pred&& pred) {
+            return Iterable::any_of_impl<It>::apply(
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr auto apply(Xs&& xs, Pred&& pred) {
+            return any_of_helper(
+                random_access_detail::constant_results<Xs, Pred>{},
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred)
+            );
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_RANDOM_ACCESS_ITERABLE_HPP
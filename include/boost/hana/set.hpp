@@ -18,13 +18,19 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/core/models.hpp>
 #include <boost/hana/core/operators.hpp>
 #include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/closure.hpp>
 #include <boost/hana/detail/insert_fwd.hpp>
+#include <boost/hana/detail/key_index.hpp>
 #include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/functional/flip.hpp>
 #include <boost/hana/functional/id.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/lazy.hpp>
 #include <boost/hana/logical.hpp>
+#include <boost/hana/maybe.hpp>
 #include <boost/hana/searchable.hpp>
 #include <boost/hana/tuple.hpp>
 
@@ -33,9 +39,13 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // _set
     //////////////////////////////////////////////////////////////////////////
+    // Note: `operators::adl` is not a direct base, because the elements of the
+    // storage may have it as a base too. Two `operators::adl` subobjects
+    // can't share an address, so the _set would be padded. `Searchable_ops`
+    // is enough to make the operators visible to ADL anyway.
     template <typename ...Xs>
-    struct _set : operators::adl, operators::Searchable_ops<_set<Xs...>> {
-        _tuple<Xs...> storage;
+    struct _set : operators::Searchable_ops<_set<Xs...>> {
+        tuple_detail::basic_tuple<Xs...> storage;
         using hana = _set;
         using datatype = Set;
 
@@ -105,6 +115,75 @@ namespace boost { namespace hana {
         }
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Looking up an element in a set is done through `detail::find_key_index`
+    // when possible, which requires a constant number of instantiations.
+    // Otherwise, we fall back to a linear search.
+    //////////////////////////////////////////////////////////////////////////
+    namespace set_detail {
+        template <typename Set, typename Key>
+        struct find_index;
+
+        template <typename ...Xs, typename Key>
+        struct find_index<_set<Xs...>, Key>
+            : detail::find_key_index<Key, Xs...>
+        { };
+
+        template <typename Set, typename Key>
+        using find_index_t = typename find_index<
+            typename detail::std::decay<Set>::type, Key
+        >::type;
+    }
+
+    template <>
+    struct find_impl<Set> {
+        template <typename S, typename Key, detail::std::size_t i>
+        static constexpr auto find_helper(S&& set, Key&&,
+                                _integral_constant<detail::std::size_t, i>)
+        { return hana::just(detail::get<i>(static_cast<S&&>(set).storage)); }
+
+        template <typename S, typename Key>
+        static constexpr auto find_helper(S&&, Key&&, detail::key_not_found)
+        { return nothing; }
+
+        template <typename S, typename Key>
+        static constexpr auto find_helper(S&& set, Key&& key, detail::key_not_indexed) {
+            return hana::find_if(static_cast<S&&>(set),
+                    hana::equal.to(static_cast<Key&&>(key)));
+        }
+
+        template <typename S, typename Key>
+        static constexpr auto apply(S&& set, Key&& key) {
+            return find_helper(static_cast<S&&>(set), static_cast<Key&&>(key),
+                               set_detail::find_index_t<S, Key>{});
+        }
+    };
+
+    template <>
+    struct contains_impl<Set> {
+        template <typename S, typename Key, detail::std::size_t i>
+        static constexpr auto contains_helper(S&&, Key&&,
+                                _integral_constant<detail::std::size_t, i>)
+        { return true_; }
+
+        template <typename S, typename Key>
+        static constexpr auto contains_helper(S&&, Key&&, detail::key_not_found)
+        { return false_; }
+
+        template <typename S, typename Key>
+        static constexpr auto
+        contains_helper(S&& set, Key&& key, detail::key_not_indexed) {
+            return hana::any_of(static_cast<S&&>(set),
+                    hana::equal.to(static_cast<Key&&>(key)));
+        }
+
+        template <typename S, typename Key>
+        static constexpr auto apply(S&& set, Key&& key) {
+            return contains_helper(static_cast<S&&>(set), static_cast<Key&&>(key),
+                                   set_detail::find_index_t<S, Key>{});
+        }
+    };
+
     template <>
     struct any_of_impl<Set> {
         template <typename Set, typename Pred>
@@ -117,13 +196,54 @@ namespace boost { namespace hana {
     //////////////////////////////////////////////////////////////////////////
     // Conversions
     //////////////////////////////////////////////////////////////////////////
+    namespace set_detail {
+        // When all the elements have a canonical type, the duplicates are
+        // removed in a single pass with `detail::unique_key_indices` and the
+        // set is created with a single expansion. Otherwise, the elements
+        // are inserted one by one, which requires a linear search for each
+        // of them.
+        struct make_unique_set {
+            template <typename Xs, detail::std::size_t ...i>
+            static constexpr auto
+            unique_helper(Xs&& xs, detail::std::index_sequence<i...>) {
+                return hana::make<Set>(
+                    detail::get<i>(static_cast<Xs&&>(xs))...
+                );
+            }
+
+            template <typename ...X>
+            static constexpr auto
+            helper(decltype(true_), X&& ...x) {
+                return unique_helper(
+                    hana::make<Tuple>(static_cast<X&&>(x)...),
+                    detail::unique_key_indices<X...>{}
+                );
+            }
+
+            template <typename ...X>
+            static constexpr auto
+            helper(decltype(false_), X&& ...x) {
+                return hana::fold.left(
+                    hana::make<Tuple>(static_cast<X&&>(x)...),
+                    hana::make<Set>(),
+                    hana::insert
+                );
+            }
+
+            template <typename ...X>
+            constexpr auto operator()(X&& ...x) const {
+                return helper(bool_<detail::all_keys_canonical<X...>::value>,
+                              static_cast<X&&>(x)...);
+            }
+        };
+    }
+
     template <typename F>
     struct to_impl<Set, F, when<_models<Foldable, F>{}()>> {
         template <typename Xs>
         static constexpr decltype(auto) apply(Xs&& xs) {
-            return hana::fold.left(static_cast<Xs&&>(xs),
-                                   hana::make<Set>(),
-                                   hana::insert);
+            return hana::unpack(static_cast<Xs&&>(xs),
+                                set_detail::make_unique_set{});
         }
     };
 
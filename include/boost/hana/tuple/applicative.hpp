@@ -0,0 +1,37 @@
+/*!
+@file
+Defines the model of `boost::hana::Applicative` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_APPLICATIVE_HPP
+#define BOOST_HANA_TUPLE_APPLICATIVE_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/applicative.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Applicative
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct lift_impl<Tuple> {
+        // _tuple
+        template <typename X>
+        static constexpr _tuple<typename detail::std::decay<X>::type> apply(X&& x)
+        { return {static_cast<X&&>(x)}; }
+
+        // tuple_t
+        template <typename T>
+        static constexpr auto apply(_type<T> const&)
+        { return tuple_t<T>; }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_APPLICATIVE_HPP
@@ -0,0 +1,135 @@
+/*!
+@file
+Defines the model of `boost::hana::Comparable` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_COMPARABLE_HPP
+#define BOOST_HANA_TUPLE_COMPARABLE_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/enable_if.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/lazy.hpp>
+#include <boost/hana/logical.hpp>
+#include <boost/hana/searchable.hpp>
+
+
+namespace boost { namespace hana {
+    namespace tuple_detail {
+        // Function object mapping an index `i` to the result of comparing
+        // the `i`-th elements of two tuples. It is only used in unevaluated
+        // contexts.
+        template <typename Xs, typename Ys>
+        struct equal_at {
+            template <typename I>
+            auto operator()(I) const -> decltype(hana::equal(
+                detail::get<I::value>(detail::std::declval<Xs const&>()),
+                detail::get<I::value>(detail::std::declval<Ys const&>())
+            ));
+        };
+
+        template <typename Xs, typename Ys, typename Indices>
+        struct elementwise_equal_impl;
+
+        template <typename Xs, typename Ys, detail::std::size_t ...i>
+        struct elementwise_equal_impl<Xs, Ys, detail::std::index_sequence<i...>> {
+            using type = constant_results<
+                equal_at<Xs, Ys>,
+                _integral_constant<detail::std::size_t, i>...
+            >;
+        };
+
+        // The results of comparing the first `n` elements of two tuples
+        // with `hana::equal`, or `not_constant`.
+        template <typename Xs, typename Ys, detail::std::size_t n>
+        using elementwise_equal = typename elementwise_equal_impl<
+            Xs, Ys, detail::std::make_index_sequence<n>
+        >::type;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Comparable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct equal_impl<Tuple, Tuple> {
+        // tuple_t
+        template <typename ...T>
+        static constexpr auto apply(_tuple_t<T...> const&,
+                                    _tuple_t<T...> const&)
+        { return true_; }
+
+        // tuple_c
+        template <typename V, V ...v, typename U, U ...u, typename =
+            detail::std::enable_if_t<sizeof...(v) == sizeof...(u)>>
+        static constexpr auto apply(_tuple_c<V, v...> const&,
+                                    _tuple_c<U, u...> const&)
+        {
+            constexpr bool comparisons[] = {true, (v == u)...};
+            return bool_<hana::all(comparisons)>;
+        }
+
+        // tuple
+        template <detail::std::size_t i, detail::std::size_t n>
+        struct equal_tuple {
+            template <typename Xs, typename Ys>
+            constexpr decltype(auto) operator()(Xs const* xs, Ys const* ys) const {
+                return hana::eval_if(
+                    hana::equal(detail::get<i>(*xs), detail::get<i>(*ys)),
+                    hana::lazy(equal_tuple<i+1, n>{})(xs, ys),
+                    hana::lazy(false_)
+                );
+            }
+        };
+
+        template <detail::std::size_t n>
+        struct equal_tuple<n, n> {
+            constexpr auto operator()(...) const
+            { return true_; }
+        };
+
+        // When all the elementwise comparisons return Constants, they are
+        // computed at once and no short-circuiting is required.
+        template <bool ...b, typename Xs, typename Ys>
+        static constexpr auto
+        equal_helper(tuple_detail::bools<b...>, Xs const&, Ys const&) {
+            return bool_<(tuple_detail::bools<b...>::find(false)
+                                                    == sizeof...(b))>;
+        }
+
+        template <typename Xs, typename Ys>
+        static constexpr decltype(auto)
+        equal_helper(tuple_detail::not_constant, Xs const& xs, Ys const& ys)
+        { return equal_tuple<0, Xs::size>{}(&xs, &ys); }
+
+        template <typename Xs, typename Ys, typename = detail::std::enable_if_t<
+            (Xs::size == Ys::size && Xs::size != 0) &&
+            !(Xs::is_tuple_t && detail::std::is_same<Xs, Ys>::value) &&
+            !(Xs::is_tuple_c && Ys::is_tuple_c)
+        >>
+        static constexpr decltype(auto) apply(Xs const& xs, Ys const& ys) {
+            return equal_helper(
+                tuple_detail::elementwise_equal<Xs, Ys, Xs::size>{}, xs, ys
+            );
+        }
+
+
+        // empty tuples and tuples with different sizes
+        template <typename Xs, typename Ys, typename = detail::std::enable_if_t<
+            Xs::size != Ys::size || Xs::size == 0
+        >>
+        static constexpr decltype(auto) apply(Xs const& /*xs*/, Ys const& /*ys*/, ...)
+        { return bool_<Xs::size == 0 && Ys::size == 0>; }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_COMPARABLE_HPP
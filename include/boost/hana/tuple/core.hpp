@@ -0,0 +1,638 @@
+/*!
+@file
+Defines the core of `boost::hana::Tuple`.
+
+This header only provides the `Tuple` data types, `make<Tuple>` and the
+basic `Foldable` and `Iterable` operations (`unpack`, the folds, `length`,
+`for_each`, `head`, `tail`, `at` and `is_empty`). The other methods of the
+concepts modeled by `Tuple` are provided by the other headers in the
+`boost/hana/tuple/` directory, and `boost/hana/tuple.hpp` includes all of
+them.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_CORE_HPP
+#define BOOST_HANA_TUPLE_CORE_HPP
+
+#include <boost/hana/fwd/tuple.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/constant.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/operators.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/predicate_results.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/remove_cv.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/type_foldl1.hpp>
+#include <boost/hana/detail/type_foldr1.hpp>
+#include <boost/hana/detail/variadic/at.hpp>
+#include <boost/hana/detail/variadic/foldl1.hpp>
+#include <boost/hana/detail/variadic/foldr1.hpp>
+#include <boost/hana/detail/variadic/for_each.hpp>
+#include <boost/hana/fwd/comparable.hpp>
+#include <boost/hana/fwd/foldable.hpp>
+#include <boost/hana/fwd/iterable.hpp>
+#include <boost/hana/fwd/monad.hpp>
+#include <boost/hana/fwd/orderable.hpp>
+#include <boost/hana/integral_constant.hpp>
+#include <boost/hana/type.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // tuple, tuple_t and tuple_c
+    //////////////////////////////////////////////////////////////////////////
+    // Note: `operators::adl` is not a direct base, because the elements of
+    // the closure may already have it as a base when they are stored as
+    // empty bases, which would make it ambiguous. `Iterable_ops` is enough
+    // to make the operators visible to ADL anyway.
+    template <typename ...Xs>
+    struct _tuple
+        : detail::closure<Xs...>
+        , operators::Iterable_ops<_tuple<Xs...>>
+    {
+        using detail::closure<Xs...>::closure; // inherit constructor
+        _tuple() = default;
+        _tuple(_tuple&&) = default;
+        _tuple(_tuple const&) = default;
+        _tuple(_tuple&) = default;
+
+        using hana = _tuple;
+        using datatype = Tuple;
+
+        static constexpr detail::std::size_t size = sizeof...(Xs);
+        static constexpr bool is_tuple_t = false;
+        static constexpr bool is_tuple_c = false;
+    };
+
+    namespace tuple_detail {
+        // A `_tuple` without the operators, for the tuples that are never
+        // handed to the user, like the `storage` of a type list or of a
+        // `Set`. This saves instantiating `Iterable_ops` for each of them.
+        template <typename ...Xs>
+        struct basic_tuple : detail::closure<Xs...> {
+            using detail::closure<Xs...>::closure; // inherit constructor
+            basic_tuple() = default;
+            basic_tuple(basic_tuple&&) = default;
+            basic_tuple(basic_tuple const&) = default;
+            basic_tuple(basic_tuple&) = default;
+
+            using hana = basic_tuple;
+            using datatype = Tuple;
+
+            static constexpr detail::std::size_t size = sizeof...(Xs);
+            static constexpr bool is_tuple_t = false;
+            static constexpr bool is_tuple_c = false;
+        };
+    }
+
+    // `tuple_c` and `tuple_t` are pure type lists; they do not inherit from
+    // a `_tuple`, which would instantiate one base class per element just
+    // to name them. Algorithms that need their elements as objects use the
+    // `storage` of the tuple, which is only created when required (see
+    // `tuple_detail::storage`).
+    template <typename T, T ...v>
+    struct _tuple_c : operators::Iterable_ops<_tuple_c<T, v...>> {
+        using hana = _tuple_c;
+        using datatype = Tuple;
+        using storage = tuple_detail::basic_tuple<_integral_constant<T, v>...>;
+
+        static constexpr detail::std::size_t size = sizeof...(v);
+        static constexpr bool is_tuple_t = false;
+        static constexpr bool is_tuple_c = true;
+    };
+
+    template <typename ...T>
+    struct _tuple_t {
+        struct _;
+    };
+
+    template <typename ...T>
+    struct _tuple_t<T...>::_
+        : _tuple_t<T...>
+        , operators::Iterable_ops<typename _tuple_t<T...>::_>
+    {
+        using hana = _;
+        using datatype = Tuple;
+        using storage = tuple_detail::basic_tuple<
+            typename detail::std::remove_cv<decltype(type<T>)>::type...
+        >;
+
+        static constexpr detail::std::size_t size = sizeof...(T);
+        static constexpr bool is_tuple_t = true;
+        static constexpr bool is_tuple_c = false;
+    };
+
+    namespace detail {
+        // The elements of a `tuple_t` and a `tuple_c` are picked from their
+        // parameter pack directly, which makes most algorithms implemented
+        // with `detail::get` work on them without creating their storage.
+        template <detail::std::size_t n, typename ...T>
+        constexpr auto get(_tuple_t<T...> const&)
+        { return type<detail::variadic::at_t<n, T...>>; }
+
+        template <detail::std::size_t n, typename T, T ...v>
+        constexpr auto get(_tuple_c<T, v...> const&)
+        { return detail::variadic::at_t<n, _integral_constant<T, v>...>{}; }
+    }
+
+    namespace tuple_detail {
+        template <typename Xs>
+        using is_type_list = _integral_constant<bool,
+            detail::std::remove_reference<Xs>::type::is_tuple_t ||
+            detail::std::remove_reference<Xs>::type::is_tuple_c
+        >;
+
+        template <typename Xs>
+        constexpr typename Xs::storage storage_of{};
+
+        template <typename Xs>
+        constexpr Xs&& storage_impl(Xs&& xs, decltype(false_))
+        { return static_cast<Xs&&>(xs); }
+
+        template <typename Xs>
+        constexpr auto const& storage_impl(Xs&&, decltype(true_)) {
+            return storage_of<
+                typename detail::std::remove_reference<Xs>::type
+            >;
+        }
+
+        // Returns `xs` itself, or a `_tuple` holding the elements of `xs`
+        // if it is a `tuple_t` or a `tuple_c`. Like the `tuple_t` and the
+        // `tuple_c` variables, that `_tuple` has static storage duration,
+        // so references to its elements never dangle.
+        template <typename Xs>
+        constexpr decltype(auto) storage(Xs&& xs) {
+            return tuple_detail::storage_impl(static_cast<Xs&&>(xs),
+                                              is_type_list<Xs>{});
+        }
+
+        // Tags used to dispatch on the representation of a tuple, which is
+        // given by its static `is_tuple_t` and `is_tuple_c` members. The
+        // methods below pick their implementation by overloading on these
+        // tags, instead of trying each implementation in turn.
+        template <bool, bool>
+        struct tag { };
+
+        using closure_tag = tag<false, false>;
+        using tuple_c_tag = tag<true, false>;
+        using tuple_t_tag = tag<true, true>;
+
+        template <typename Xs,
+                  typename Raw = typename detail::std::remove_reference<Xs>::type>
+        using tag_of = tag<Raw::is_tuple_t || Raw::is_tuple_c, Raw::is_tuple_t>;
+
+        // The type of a reference to the `element` `E` of a closure of type
+        // `Xs`, where `Xs` is deduced from a forwarding reference. This makes
+        // a single overload enough to forward the elements of a closure with
+        // the right value category.
+        template <typename Xs>
+        struct forward_as { template <typename E> using type = E&&; };
+
+        template <typename Xs>
+        struct forward_as<Xs&> { template <typename E> using type = E&; };
+
+        template <typename Xs>
+        struct forward_as<Xs const&> { template <typename E> using type = E const&; };
+
+        template <typename Xs>
+        struct forward_as<Xs const> { template <typename E> using type = E const&; };
+
+        template <typename Xs, typename E>
+        using element_t = typename forward_as<Xs>::template type<E>;
+    }
+
+    template <>
+    struct operators::of<Tuple>
+        : operators::of<Comparable, Orderable, Monad, Iterable>
+    { };
+
+    //////////////////////////////////////////////////////////////////////////
+    // make
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct make_impl<Tuple> {
+        template <typename ...Xs>
+        static constexpr
+        _tuple<typename detail::std::decay<Xs>::type...> apply(Xs&& ...xs)
+        { return {static_cast<Xs&&>(xs)...}; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // utilities
+    //////////////////////////////////////////////////////////////////////////
+    namespace tuple_detail {
+        template <typename Xs>
+        using size = _integral_constant<detail::std::size_t,
+            detail::std::remove_reference<Xs>::type::size
+        >;
+
+        template <bool, typename T>
+        using expand = T;
+
+        template <detail::std::size_t from, typename Xs, detail::std::size_t ...i>
+        constexpr decltype(auto)
+        slice(Xs&& xs, detail::std::index_sequence<i...>) {
+            return hana::make<Tuple>(detail::get<from + i>(
+                                            static_cast<Xs&&>(xs))...);
+        }
+
+        using detail::bools;
+        using detail::constant_results;
+        using detail::not_constant;
+        using detail::predicate_results;
+
+    }
+
+    namespace tuple_detail {
+        // The results of calling `Pred` on the types of a `tuple_t`, as
+        // computed by `Results` (`predicate_results` or `constant_results`).
+        // When `Pred` is a trait like `trait<F>` or `integral(metafunction<F>)`,
+        // the results are read from the metafunction directly, without
+        // creating any `Type` nor calling the predicate.
+        template <template <typename ...> class Results,
+                  typename Pred, typename Decayed, typename ...T>
+        struct type_results_impl {
+            using type = Results<Pred, decltype(hana::type<T>)&...>;
+        };
+
+        template <template <typename ...> class Results,
+                  typename Pred, typename F, typename ...T>
+        struct type_results_impl<Results, Pred, _integral<F>, T...> {
+            using type = bools<static_cast<bool>(
+                F::template apply<T>::type::value
+            )...>;
+        };
+
+        template <typename Pred, typename ...T>
+        using type_results = typename type_results_impl<predicate_results,
+            Pred, typename detail::std::decay<Pred>::type, T...
+        >::type;
+
+        // Only declared; used to retrieve the `constant_results` of a
+        // predicate over the elements of a tuple of type `Xs`, with the
+        // value category of `Xs`.
+        template <typename Pred, typename Xs, typename ...E>
+        constant_results<Pred, element_t<Xs, typename E::get_type>...>
+        constant_results_of(detail::closure_impl<E...> const&);
+
+        template <typename Pred, typename Xs, typename ...T>
+        typename type_results_impl<constant_results,
+            Pred, typename detail::std::decay<Pred>::type, T...
+        >::type constant_results_of(_tuple_t<T...> const&);
+
+        template <typename Pred, typename Xs, typename T, T ...v>
+        constant_results<Pred, decltype(integral_constant<T, v>)&...>
+        constant_results_of(_tuple_c<T, v...> const&);
+
+        template <typename Pred, typename Xs>
+        using constant_results_of_t = decltype(
+            tuple_detail::constant_results_of<Pred, Xs>(
+                detail::std::declval<Xs>())
+        );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    // The methods below call a `helper` with the tag of the tuple, the tuple
+    // as a pattern from which its elements are deduced, and the tuple again
+    // to be forwarded. The `Metafunction`s are taken by value, so that the
+    // overloads taking them are preferred over those taking a forwarding
+    // reference even for rvalues.
+    template <>
+    struct unpack_impl<Tuple> {
+        template <typename ...E, typename Xs, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::closure_tag, detail::closure_impl<E...> const&,
+               Xs&& xs, F&& f)
+        {
+            return static_cast<F&&>(f)(
+                detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs))...
+            );
+        }
+
+        template <typename ...T, typename Xs, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const&, Xs&&, F&& f)
+        { return static_cast<F&&>(f)(type<T>...); }
+
+        template <typename ...T, typename Xs, template <typename ...> class F>
+        static constexpr auto
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const&, Xs&&, _metafunction<F>)
+        { return type<typename F<T...>::type>; }
+
+        template <typename T, T ...v, typename Xs, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::tuple_c_tag, _tuple_c<T, v...> const&, Xs&&, F&& f)
+        { return static_cast<F&&>(f)(integral_constant<T, v>...); }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return helper(tuple_detail::tag_of<Xs>{}, xs,
+                          static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+    };
+
+    template <>
+    struct fold_left_impl<Tuple> {
+        template <typename ...E, typename Xs, typename S, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::closure_tag, detail::closure_impl<E...> const&,
+               Xs&& xs, S&& s, F&& f)
+        {
+            return detail::variadic::foldl1(
+                static_cast<F&&>(f),
+                static_cast<S&&>(s),
+                detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs))...
+            );
+        }
+
+        template <typename ...T, typename Xs, typename S, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const&, Xs&&, S&& s, F&& f) {
+            auto const& storage = tuple_detail::storage_of<typename _tuple_t<T...>::_>;
+            return helper(tuple_detail::closure_tag{}, storage, storage,
+                          static_cast<S&&>(s), static_cast<F&&>(f));
+        }
+
+        template <typename T, T ...v, typename Xs, typename S, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::tuple_c_tag, _tuple_c<T, v...> const&, Xs&&, S&& s, F&& f) {
+            auto const& storage = tuple_detail::storage_of<_tuple_c<T, v...>>;
+            return helper(tuple_detail::closure_tag{}, storage, storage,
+                          static_cast<S&&>(s), static_cast<F&&>(f));
+        }
+
+        // The state is taken by forwarding reference like in the generic
+        // `tuple_t_tag` overload, so that this one is more specialized. Like
+        // with `metafunction<F>`, it may be a `Type` or any other object.
+        template <typename ...T, typename Xs, typename S, template <typename ...> class F>
+        static constexpr auto
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const&, Xs&&,
+               S&&, _metafunction<F>)
+        {
+            return type<typename detail::type_foldl1<
+                F, typename detail::_decltype<S>::type, T...
+            >::type>;
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            return helper(tuple_detail::tag_of<Xs>{}, xs, static_cast<Xs&&>(xs),
+                          static_cast<S&&>(s), static_cast<F&&>(f));
+        }
+    };
+
+    template <>
+    struct fold_left_nostate_impl<Tuple> {
+        template <typename ...E, typename Xs, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::closure_tag, detail::closure_impl<E...> const&,
+               Xs&& xs, F&& f)
+        {
+            return detail::variadic::foldl1(
+                static_cast<F&&>(f),
+                detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs))...
+            );
+        }
+
+        template <typename ...T, typename Xs, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const&, Xs&&, F&& f) {
+            auto const& storage = tuple_detail::storage_of<typename _tuple_t<T...>::_>;
+            return helper(tuple_detail::closure_tag{}, storage, storage,
+                          static_cast<F&&>(f));
+        }
+
+        template <typename T, T ...v, typename Xs, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::tuple_c_tag, _tuple_c<T, v...> const&, Xs&&, F&& f) {
+            auto const& storage = tuple_detail::storage_of<_tuple_c<T, v...>>;
+            return helper(tuple_detail::closure_tag{}, storage, storage,
+                          static_cast<F&&>(f));
+        }
+
+        template <typename ...T, typename Xs, template <typename ...> class F>
+        static constexpr auto
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const&, Xs&&, _metafunction<F>)
+        { return type<typename detail::type_foldl1<F, T...>::type>; }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return helper(tuple_detail::tag_of<Xs>{}, xs,
+                          static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+    };
+
+    template <>
+    struct fold_right_impl<Tuple> {
+        template <typename ...E, typename Xs, typename S, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::closure_tag, detail::closure_impl<E...> const&,
+               Xs&& xs, S&& s, F&& f)
+        {
+            return detail::variadic::foldr1(
+                static_cast<F&&>(f),
+                detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs))...,
+                static_cast<S&&>(s)
+            );
+        }
+
+        template <typename ...T, typename Xs, typename S, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const&, Xs&&, S&& s, F&& f) {
+            auto const& storage = tuple_detail::storage_of<typename _tuple_t<T...>::_>;
+            return helper(tuple_detail::closure_tag{}, storage, storage,
+                          static_cast<S&&>(s), static_cast<F&&>(f));
+        }
+
+        template <typename T, T ...v, typename Xs, typename S, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::tuple_c_tag, _tuple_c<T, v...> const&, Xs&&, S&& s, F&& f) {
+            auto const& storage = tuple_detail::storage_of<_tuple_c<T, v...>>;
+            return helper(tuple_detail::closure_tag{}, storage, storage,
+                          static_cast<S&&>(s), static_cast<F&&>(f));
+        }
+
+        // The state is taken by forwarding reference like in the generic
+        // `tuple_t_tag` overload, so that this one is more specialized. Like
+        // with `metafunction<F>`, it may be a `Type` or any other object.
+        template <typename ...T, typename Xs, typename S, template <typename ...> class F>
+        static constexpr auto
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const&, Xs&&,
+               S&&, _metafunction<F>)
+        {
+            return type<typename detail::type_foldr1<
+                F, T..., typename detail::_decltype<S>::type
+            >::type>;
+        }
+
+        template <typename Xs, typename S, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, S&& s, F&& f) {
+            return helper(tuple_detail::tag_of<Xs>{}, xs, static_cast<Xs&&>(xs),
+                          static_cast<S&&>(s), static_cast<F&&>(f));
+        }
+    };
+
+    template <>
+    struct fold_right_nostate_impl<Tuple> {
+        template <typename ...E, typename Xs, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::closure_tag, detail::closure_impl<E...> const&,
+               Xs&& xs, F&& f)
+        {
+            return detail::variadic::foldr1(
+                static_cast<F&&>(f),
+                detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs))...
+            );
+        }
+
+        template <typename ...T, typename Xs, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const&, Xs&&, F&& f) {
+            auto const& storage = tuple_detail::storage_of<typename _tuple_t<T...>::_>;
+            return helper(tuple_detail::closure_tag{}, storage, storage,
+                          static_cast<F&&>(f));
+        }
+
+        template <typename T, T ...v, typename Xs, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::tuple_c_tag, _tuple_c<T, v...> const&, Xs&&, F&& f) {
+            auto const& storage = tuple_detail::storage_of<_tuple_c<T, v...>>;
+            return helper(tuple_detail::closure_tag{}, storage, storage,
+                          static_cast<F&&>(f));
+        }
+
+        template <typename ...T, typename Xs, template <typename ...> class F>
+        static constexpr auto
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const&, Xs&&, _metafunction<F>)
+        { return type<typename detail::type_foldr1<F, T...>::type>; }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return helper(tuple_detail::tag_of<Xs>{}, xs,
+                          static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+    };
+
+    template <>
+    struct length_impl<Tuple> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&)
+        { return size_t<Xs::size>; }
+    };
+
+    template <>
+    struct for_each_impl<Tuple> {
+        template <typename ...E, typename Xs, typename F>
+        static constexpr void
+        helper(tuple_detail::closure_tag, detail::closure_impl<E...> const&,
+               Xs&& xs, F&& f)
+        {
+            detail::variadic::for_each(
+                static_cast<F&&>(f),
+                detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs))...
+            );
+        }
+
+        template <typename ...T, typename Xs, typename F>
+        static constexpr void
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const&, Xs&&, F&& f) {
+            auto const& storage = tuple_detail::storage_of<typename _tuple_t<T...>::_>;
+            helper(tuple_detail::closure_tag{}, storage, storage,
+                   static_cast<F&&>(f));
+        }
+
+        template <typename T, T ...v, typename Xs, typename F>
+        static constexpr void
+        helper(tuple_detail::tuple_c_tag, _tuple_c<T, v...> const&, Xs&&, F&& f) {
+            auto const& storage = tuple_detail::storage_of<_tuple_c<T, v...>>;
+            helper(tuple_detail::closure_tag{}, storage, storage,
+                   static_cast<F&&>(f));
+        }
+
+        template <typename Xs, typename F>
+        static constexpr void apply(Xs&& xs, F&& f) {
+            helper(tuple_detail::tag_of<Xs>{}, xs,
+                   static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct head_impl<Tuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs)
+        { return detail::get<0>(static_cast<Xs&&>(xs)); }
+    };
+
+    template <>
+    struct at_impl<Tuple> {
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N const&, Xs&& xs) {
+            constexpr detail::std::size_t index = hana::value<N>();
+            return detail::get<index>(static_cast<Xs&&>(xs));
+        }
+    };
+
+    template <>
+    struct tail_impl<Tuple> {
+        template <typename X, typename ...Xn, typename Xs>
+        static constexpr _tuple<typename Xn::get_type...>
+        helper(tuple_detail::closure_tag, detail::closure_impl<X, Xn...> const&,
+               Xs&& xs)
+        { return {detail::get(static_cast<tuple_detail::element_t<Xs, Xn>>(xs))...}; }
+
+        template <typename T, typename ...Ts, typename Xs>
+        static constexpr auto
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T, Ts...> const&, Xs&&)
+        { return tuple_t<Ts...>; }
+
+        template <typename T, T v, T ...vs, typename Xs>
+        static constexpr auto
+        helper(tuple_detail::tuple_c_tag, _tuple_c<T, v, vs...> const&, Xs&&)
+        { return tuple_c<T, vs...>; }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs)
+        { return helper(tuple_detail::tag_of<Xs>{}, xs, static_cast<Xs&&>(xs)); }
+    };
+
+    template <>
+    struct is_empty_impl<Tuple> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const&)
+        { return bool_<Xs::size == 0>; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // models
+    //////////////////////////////////////////////////////////////////////////
+    // These are stated explicitly, since the generic definitions live in
+    // `foldable.hpp` and `iterable.hpp`, which this header does not include.
+    template <>
+    struct models_impl<Foldable, Tuple>
+        : decltype(true_)
+    { };
+
+    template <>
+    struct models_impl<Iterable, Tuple>
+        : decltype(true_)
+    { };
+
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_CORE_HPP
@@ -0,0 +1,179 @@
+/*!
+@file
+Defines the model of `boost::hana::Foldable` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_FOLDABLE_HPP
+#define BOOST_HANA_TUPLE_FOLDABLE_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/detail/constexpr/algorithm.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct count_if_impl<Tuple> {
+        template <bool ...b, typename Xs, typename Pred>
+        static constexpr auto
+        count_if_helper(tuple_detail::bools<b...>, Xs&&, Pred&&)
+        { return size_t<tuple_detail::bools<b...>::count(true)>; }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        count_if_helper(tuple_detail::not_constant, Xs&& xs, Pred&& pred) {
+            return count_if_impl<Tuple, when<true>>::apply(
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            return count_if_impl::count_if_helper(
+                tuple_detail::constant_results_of_t<Pred, Xs>{},
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred)
+            );
+        }
+    };
+
+    namespace tuple_detail {
+        // Only declared; the values of a tuple whose elements are all
+        // `_integral_constant`s with the same value type, as an
+        // `integer_sequence`, or `not_constant` for any other tuple.
+        template <typename T, T ...v>
+        detail::std::integer_sequence<T, v...>
+        integral_values_of(_tuple<_integral_constant<T, v>...> const&);
+
+        template <typename T, T ...v>
+        detail::std::integer_sequence<T, v...>
+        integral_values_of(_tuple_c<T, v...> const&);
+
+        not_constant integral_values_of(...);
+
+        template <typename Xs>
+        using integral_values_of_t = decltype(
+            tuple_detail::integral_values_of(detail::std::declval<Xs>())
+        );
+    }
+
+    template <>
+    struct count_impl<Tuple> {
+        template <typename T, T ...v, T u, typename Xs, typename Value>
+        static constexpr auto
+        count_helper(detail::std::integer_sequence<T, v...>,
+                     _integral_constant<T, u>*, Xs&&, Value&&)
+        {
+            constexpr T values[sizeof...(v)+1] = {v...};
+            //                             ^ avoid empty array
+            return size_t<detail::constexpr_::count(
+                values, values + sizeof...(v), u)>;
+        }
+
+        template <typename Values, typename V, typename Xs, typename Value>
+        static constexpr decltype(auto)
+        count_helper(Values, V*, Xs&& xs, Value&& value) {
+            return count_impl<Tuple, when<true>>::apply(
+                static_cast<Xs&&>(xs), static_cast<Value&&>(value));
+        }
+
+        template <typename Xs, typename Value>
+        static constexpr decltype(auto) apply(Xs&& xs, Value&& value) {
+            using V = typename detail::std::decay<Value>::type;
+            return count_impl::count_helper(
+                tuple_detail::integral_values_of_t<Xs>{}, (V*)nullptr,
+                static_cast<Xs&&>(xs), static_cast<Value&&>(value)
+            );
+        }
+    };
+
+    template <>
+    struct sum_impl<Tuple> {
+        template <typename M, typename T, T ...v, typename Xs, typename C =
+            typename foldable_detail::integral_fold<Monoid, M, T>::type>
+        static constexpr auto
+        sum_helper(detail::std::integer_sequence<T, v...>, Xs&&)
+        { return integral_constant<C, foldable_detail::integral_sum<C, T, v...>()>; }
+
+        template <typename M, typename Values, typename Xs>
+        static constexpr decltype(auto) sum_helper(Values, Xs&& xs)
+        { return sum_impl<Tuple, when<true>>::apply<M>(static_cast<Xs&&>(xs)); }
+
+        template <typename M, typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            return sum_impl::sum_helper<M>(
+                tuple_detail::integral_values_of_t<Xs>{}, static_cast<Xs&&>(xs));
+        }
+    };
+
+    template <>
+    struct product_impl<Tuple> {
+        template <typename R, typename T, T ...v, typename Xs, typename C =
+            typename foldable_detail::integral_fold<Ring, R, T>::type>
+        static constexpr auto
+        product_helper(detail::std::integer_sequence<T, v...>, Xs&&)
+        { return integral_constant<C, foldable_detail::integral_product<C, T, v...>()>; }
+
+        template <typename R, typename Values, typename Xs>
+        static constexpr decltype(auto) product_helper(Values, Xs&& xs)
+        { return product_impl<Tuple, when<true>>::apply<R>(static_cast<Xs&&>(xs)); }
+
+        template <typename R, typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            return product_impl::product_helper<R>(
+                tuple_detail::integral_values_of_t<Xs>{}, static_cast<Xs&&>(xs));
+        }
+    };
+
+    template <>
+    struct maximum_impl<Tuple> {
+        template <typename T, T ...v, typename Xs, typename = detail::std::
+            enable_if_t<_models<Orderable, IntegralConstant<T>>{}()>>
+        static constexpr auto
+        maximum_helper(detail::std::integer_sequence<T, v...>, Xs&&)
+        { return integral_constant<T, foldable_detail::integral_maximum<T, v...>()>; }
+
+        template <typename Values, typename Xs>
+        static constexpr decltype(auto) maximum_helper(Values, Xs&& xs)
+        { return maximum_impl<Tuple, when<true>>::apply(static_cast<Xs&&>(xs)); }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            return maximum_impl::maximum_helper(
+                tuple_detail::integral_values_of_t<Xs>{}, static_cast<Xs&&>(xs));
+        }
+    };
+
+    template <>
+    struct minimum_impl<Tuple> {
+        template <typename T, T ...v, typename Xs, typename = detail::std::
+            enable_if_t<_models<Orderable, IntegralConstant<T>>{}()>>
+        static constexpr auto
+        minimum_helper(detail::std::integer_sequence<T, v...>, Xs&&)
+        { return integral_constant<T, foldable_detail::integral_minimum<T, v...>()>; }
+
+        template <typename Values, typename Xs>
+        static constexpr decltype(auto) minimum_helper(Values, Xs&& xs)
+        { return minimum_impl<Tuple, when<true>>::apply(static_cast<Xs&&>(xs)); }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            return minimum_impl::minimum_helper(
+                tuple_detail::integral_values_of_t<Xs>{}, static_cast<Xs&&>(xs));
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_FOLDABLE_HPP
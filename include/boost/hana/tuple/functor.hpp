@@ -0,0 +1,113 @@
+/*!
+@file
+Defines the model of `boost::hana::Functor` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_FUNCTOR_HPP
+#define BOOST_HANA_TUPLE_FUNCTOR_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/functor.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct transform_impl<Tuple> {
+        template <typename ...E, typename Xs, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::closure_tag, detail::closure_impl<E...> const&,
+               Xs&& xs, F&& f)
+        {
+            return hana::make<Tuple>(
+                f(detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs)))...
+            );
+        }
+
+        template <typename E, typename Xs, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::closure_tag, detail::closure_impl<E> const&,
+               Xs&& xs, F&& f)
+        {
+            return hana::make<Tuple>(static_cast<F&&>(f)(
+                detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs))
+            ));
+        }
+
+        template <typename ...T, typename Xs, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const&, Xs&&, F&& f) {
+            auto const& storage = tuple_detail::storage_of<typename _tuple_t<T...>::_>;
+            return helper(tuple_detail::closure_tag{}, storage, storage,
+                          static_cast<F&&>(f));
+        }
+
+        template <typename T, T ...v, typename Xs, typename F>
+        static constexpr decltype(auto)
+        helper(tuple_detail::tuple_c_tag, _tuple_c<T, v...> const&, Xs&&, F&& f) {
+            auto const& storage = tuple_detail::storage_of<_tuple_c<T, v...>>;
+            return helper(tuple_detail::closure_tag{}, storage, storage,
+                          static_cast<F&&>(f));
+        }
+
+        template <typename ...T, typename Xs, template <typename ...> class F>
+        static constexpr auto
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const&, Xs&&, _metafunction<F>)
+        { return tuple_t<typename F<T>::type...>; }
+
+        template <typename Xs, typename F>
+        static constexpr decltype(auto) apply(Xs&& xs, F&& f) {
+            return helper(tuple_detail::tag_of<Xs>{}, xs,
+                          static_cast<Xs&&>(xs), static_cast<F&&>(f));
+        }
+    };
+
+    template <>
+    struct fill_impl<Tuple> {
+        template <typename ...T>
+        struct pack { };
+
+        template <typename V>
+        static constexpr _tuple<> helper(pack<> const&, V&&)
+        { return {}; }
+
+        template <typename X, typename ...Xs, typename V>
+        static constexpr _tuple<
+            typename detail::std::decay<V>::type,
+            typename detail::std::decay<
+                tuple_detail::expand<!!sizeof(Xs), V>
+            >::type...
+        > helper(pack<X, Xs...> const&, V&& v)
+        { return {((void)sizeof(Xs), v)..., static_cast<V&&>(v)}; }
+
+        template <typename ...Xs, typename T>
+        static constexpr auto helper(pack<Xs...> const&, _type<T> const&)
+        { return tuple_t<tuple_detail::expand<!!sizeof(Xs), T>...>; }
+
+        template <typename ...T, typename V>
+        static constexpr decltype(auto) apply(_tuple<T...> const&, V&& v)
+        { return helper(pack<T...>{}, static_cast<V&&>(v)); }
+
+        template <typename ...T, typename V>
+        static constexpr decltype(auto) apply(_tuple_t<T...> const&, V&& v)
+        { return helper(pack<decltype(type<T>)...>{}, static_cast<V&&>(v)); }
+
+        template <typename T, T ...v, typename V>
+        static constexpr decltype(auto) apply(_tuple_c<T, v...> const&, V&& x) {
+            return helper(pack<_integral_constant<T, v>...>{},
+                          static_cast<V&&>(x));
+        }
+    };
+
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_FUNCTOR_HPP
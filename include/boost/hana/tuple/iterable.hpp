@@ -0,0 +1,101 @@
+/*!
+@file
+Defines the model of `boost::hana::Iterable` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_ITERABLE_HPP
+#define BOOST_HANA_TUPLE_ITERABLE_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/constant.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/iterable.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Iterable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct last_impl<Tuple> {
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            constexpr detail::std::size_t size = tuple_detail::size<Xs>{};
+            return detail::get<size - 1>(static_cast<Xs&&>(xs));
+        }
+    };
+
+    template <>
+    struct drop_at_most_impl<Tuple> {
+        using Size = detail::std::size_t;
+
+        template <Size n, typename Xs, Size ...i>
+        static constexpr decltype(auto)
+        drop_helper(Xs&& xs, detail::std::index_sequence<i...>) {
+            return hana::make<Tuple>(
+                        detail::get<n + i>(static_cast<Xs&&>(xs))...);
+        }
+
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N const&, Xs&& xs) {
+            constexpr Size n = hana::value<N>();
+            constexpr Size size = tuple_detail::size<Xs>{};
+            constexpr Size drop_size = n > size ? size : n;
+            return drop_helper<drop_size>(static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<size - drop_size>{});
+        }
+    };
+
+    template <>
+    struct drop_until_impl<Tuple> {
+        template <typename ...E, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(detail::closure_impl<E...> const&, Xs&& xs, Pred&&) {
+            using Results = tuple_detail::predicate_results<
+                Pred, tuple_detail::element_t<Xs, typename E::get_type>...
+            >;
+            constexpr detail::std::size_t n = Results::find(true);
+            return tuple_detail::slice<n>(static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<sizeof...(E) - n>{});
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            return drop_until_impl::helper(tuple_detail::storage(xs),
+                tuple_detail::storage(static_cast<Xs&&>(xs)),
+                static_cast<Pred&&>(pred));
+        }
+    };
+
+    template <>
+    struct drop_while_impl<Tuple> {
+        template <typename ...E, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(detail::closure_impl<E...> const&, Xs&& xs, Pred&&) {
+            using Results = tuple_detail::predicate_results<
+                Pred, tuple_detail::element_t<Xs, typename E::get_type>...
+            >;
+            constexpr detail::std::size_t n = Results::find(false);
+            return tuple_detail::slice<n>(static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<sizeof...(E) - n>{});
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            return drop_while_impl::helper(tuple_detail::storage(xs),
+                tuple_detail::storage(static_cast<Xs&&>(xs)),
+                static_cast<Pred&&>(pred));
+        }
+    };
+
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_ITERABLE_HPP
@@ -0,0 +1,90 @@
+/*!
+@file
+Defines the model of `boost::hana::Monad` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_MONAD_HPP
+#define BOOST_HANA_TUPLE_MONAD_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/generate_integer_sequence.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/monad.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Monad
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct flatten_impl<Tuple> {
+        using Size = detail::std::size_t;
+
+        template <int Which, Size ...Lengths>
+        struct flatten_indices {
+            template <typename Array>
+            constexpr auto operator()(Array outer) const {
+                constexpr Size lengths[] = {Lengths...};
+                Array inner = outer;
+                for (Size index = 0, i = 0; i < sizeof...(Lengths); ++i) {
+                    for (Size j = 0; j < lengths[i]; ++j, ++index) {
+                        inner[index] = i;
+                        outer[index] = j;
+                    }
+                }
+                return detail::get<Which>(
+                    tuple_detail::basic_tuple<Array, Array>(outer, inner));
+            }
+        };
+
+        template <typename Xs, Size ...outer, Size ...inner>
+        static constexpr decltype(auto)
+        flatten_helper(Xs&& xs, detail::std::index_sequence<outer...>,
+                                detail::std::index_sequence<inner...>)
+        {
+            return hana::make<Tuple>(detail::get<outer>(detail::get<inner>(
+                                        static_cast<Xs&&>(xs)))...);
+        }
+
+        template <typename ...E, typename Xs>
+        static constexpr decltype(auto)
+        helper(detail::closure_impl<E...> const&, Xs&& xs) {
+            constexpr /* Size */ Size lengths[] = {0,
+                tuple_detail::size<typename E::get_type>{}...
+            };
+            constexpr Size total_length = hana::sum<Size>(lengths);
+
+            using Outer = flatten_indices<0,
+                tuple_detail::size<typename E::get_type>{}...
+            >;
+            using Inner = flatten_indices<1,
+                tuple_detail::size<typename E::get_type>{}...
+            >;
+
+            return flatten_helper(static_cast<Xs&&>(xs),
+                detail::generate_index_sequence<total_length, Outer>{},
+                detail::generate_index_sequence<total_length, Inner>{});
+        }
+
+        template <typename Xs>
+        static constexpr _tuple<> helper(detail::closure_impl<> const&, Xs&&)
+        { return {}; }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            return flatten_impl::helper(tuple_detail::storage(xs),
+                tuple_detail::storage(static_cast<Xs&&>(xs)));
+        }
+    };
+
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_MONAD_HPP
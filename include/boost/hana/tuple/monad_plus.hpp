@@ -0,0 +1,288 @@
+/*!
+@file
+Defines the model of `boost::hana::MonadPlus` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_MONAD_PLUS_HPP
+#define BOOST_HANA_TUPLE_MONAD_PLUS_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/constant.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/constexpr/algorithm.hpp>
+#include <boost/hana/detail/generate_integer_sequence.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/variadic/at.hpp>
+#include <boost/hana/logical.hpp>
+#include <boost/hana/monad_plus.hpp>
+#include <boost/hana/tuple/monad.hpp>
+
+
+namespace boost { namespace hana {
+    namespace tuple_detail {
+        // Generator for `generate_index_sequence` returning the indices at
+        // which the results are equal to `value`.
+        template <typename Results, bool value>
+        struct IndicesOf;
+
+        template <bool ...b, bool value>
+        struct IndicesOf<bools<b...>, value> {
+            template <typename Array>
+            constexpr auto operator()(Array indices) const {
+                constexpr bool results[sizeof...(b)+1] = {b...};
+                //                                 ^ avoid empty array
+                detail::std::size_t i = 0;
+                for (detail::std::size_t index = 0; index != sizeof...(b);
+                                                    ++index)
+                    if (results[index] == value)
+                        indices[i++] = index;
+                return indices;
+            }
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // MonadPlus
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct concat_impl<Tuple> {
+        template <typename ...E, typename ...F, typename Xs, typename Ys>
+        static constexpr _tuple<
+            typename E::get_type..., typename F::get_type...
+        > helper(detail::closure_impl<E...> const&,
+                 detail::closure_impl<F...> const&, Xs&& xs, Ys&& ys)
+        {
+            return {
+                detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs))...,
+                detail::get(static_cast<tuple_detail::element_t<Ys, F>>(ys))...
+            };
+        }
+
+        template <typename Xs, typename Ys>
+        static constexpr decltype(auto) apply(Xs&& xs, Ys&& ys) {
+            return concat_impl::helper(
+                tuple_detail::storage(xs), tuple_detail::storage(ys),
+                tuple_detail::storage(static_cast<Xs&&>(xs)),
+                tuple_detail::storage(static_cast<Ys&&>(ys)));
+        }
+    };
+
+    template <>
+    struct empty_impl<Tuple> {
+        static constexpr _tuple<> apply()
+        { return {}; }
+    };
+
+    template <>
+    struct repeat_impl<Tuple> {
+        template <typename X>
+        static constexpr _tuple<>
+        repeat_helper(X&&, detail::std::index_sequence<>)
+        { return {}; }
+
+        template <typename X, detail::std::size_t i, detail::std::size_t ...j>
+        static constexpr _tuple<
+            typename detail::std::decay<X>::type,
+            typename detail::std::decay<tuple_detail::expand<!!j, X>>::type...
+        > repeat_helper(X&& x, detail::std::index_sequence<i, j...>)
+        { return {((void)j, x)..., static_cast<X&&>(x)}; }
+
+        template <typename T, detail::std::size_t ...i>
+        static constexpr auto
+        repeat_helper(_type<T>, detail::std::index_sequence<i...>)
+        { return tuple_t<tuple_detail::expand<!!i, T>...>; }
+
+        template <typename N, typename X>
+        static constexpr decltype(auto) apply(N const&, X&& x) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            return repeat_helper(static_cast<X&&>(x),
+                                 detail::std::make_index_sequence<n>{});
+        }
+    };
+
+    template <>
+    struct cycle_impl<Tuple> {
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N&& n, Xs&& xs) {
+            return hana::flatten(hana::repeat<Tuple>(
+                static_cast<N&&>(n),
+                static_cast<Xs&&>(xs)
+            ));
+        }
+    };
+
+    template <>
+    struct prepend_impl<Tuple> {
+        template <typename X, typename ...E, typename Xs>
+        static constexpr _tuple<
+            typename detail::std::decay<X>::type, typename E::get_type...
+        > helper(X&& x, detail::closure_impl<E...> const&, Xs&& xs) {
+            return {
+                static_cast<X&&>(x),
+                detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs))...
+            };
+        }
+
+        template <typename X, typename Xs>
+        static constexpr decltype(auto) apply(X&& x, Xs&& xs) {
+            return prepend_impl::helper(static_cast<X&&>(x),
+                tuple_detail::storage(xs),
+                tuple_detail::storage(static_cast<Xs&&>(xs)));
+        }
+    };
+
+    template <>
+    struct append_impl<Tuple> {
+        template <typename ...E, typename Xs, typename X>
+        static constexpr _tuple<
+            typename E::get_type..., typename detail::std::decay<X>::type
+        > helper(detail::closure_impl<E...> const&, Xs&& xs, X&& x) {
+            return {
+                detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs))...,
+                static_cast<X&&>(x)
+            };
+        }
+
+        template <typename Xs, typename X>
+        static constexpr decltype(auto) apply(Xs&& xs, X&& x) {
+            return append_impl::helper(tuple_detail::storage(xs),
+                tuple_detail::storage(static_cast<Xs&&>(xs)),
+                static_cast<X&&>(x));
+        }
+    };
+
+    template <>
+    struct filter_impl<Tuple> {
+        using Size = detail::std::size_t;
+
+        template <bool ...b>
+        struct KeepIndices {
+            template <typename Array>
+            constexpr auto operator()(Array indices) const {
+                constexpr bool keep[sizeof...(b)+1] = {b...};
+                //                              ^ avoid empty array
+                Size i = 0;
+                for (Size index = 0; index != sizeof...(b); ++index)
+                    if (keep[index])
+                        indices[i++] = index;
+                return indices;
+            }
+        };
+
+        template <typename Xs, Size ...i>
+        static constexpr auto
+        filter_helper(Xs&& xs, detail::std::index_sequence<i...>) {
+            return hana::make_tuple(detail::get<i>(static_cast<Xs&&>(xs))...);
+        }
+
+        template <typename ...E, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(tuple_detail::closure_tag, detail::closure_impl<E...> const&,
+               Xs&& xs, Pred&& pred)
+        {
+            constexpr bool keep[1+sizeof...(E)] = {
+                /*              ^ avoid empty array */
+                hana::if_(hana::value<decltype(pred(detail::get(
+                    static_cast<tuple_detail::element_t<Xs, E>>(xs)
+                )))>(), true, false)...
+            };
+            constexpr Size new_size = detail::constexpr_::count(
+                                keep, keep+sizeof(keep)-1, true);
+
+            return filter_impl::filter_helper(
+                static_cast<Xs&&>(xs),
+                detail::generate_index_sequence<
+                    new_size,
+                    KeepIndices<
+                        hana::if_(hana::value<decltype(pred(detail::get(
+                            static_cast<tuple_detail::element_t<Xs, E>>(xs)
+                        )))>(), true, false)...
+                    >
+                >{}
+            );
+        }
+
+        // The elements of a `tuple_t` or a `tuple_c` are filtered without
+        // creating its storage, and the result is also a type list.
+        template <typename ...T, Size ...i>
+        static constexpr auto
+        filter_helper(_tuple_t<T...> const&, detail::std::index_sequence<i...>)
+        { return tuple_t<detail::variadic::at_t<i, T...>...>; }
+
+        template <typename T, T ...v, Size ...i>
+        static constexpr auto
+        filter_helper(_tuple_c<T, v...> const&, detail::std::index_sequence<i...>) {
+            constexpr T values[sizeof...(v)+1] = {v...};
+            //                             ^ avoid empty array
+            return tuple_c<T, values[i]...>;
+        }
+
+        // Keeps the elements for which the `Results` are equal to `value`.
+        template <bool value, typename Xs, typename Results>
+        static constexpr auto keep_elements(Xs const& xs, Results) {
+            return filter_impl::filter_helper(xs,
+                detail::generate_index_sequence<Results::count(value),
+                    tuple_detail::IndicesOf<Results, value>
+                >{});
+        }
+
+        template <typename ...T, typename Xs, typename Pred>
+        static constexpr auto
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const& xs, Xs&&, Pred&&) {
+            return filter_impl::keep_elements<true>(xs,
+                tuple_detail::type_results<Pred, T...>{});
+        }
+
+        template <typename T, T ...v, typename Xs, typename Pred>
+        static constexpr auto
+        helper(tuple_detail::tuple_c_tag, _tuple_c<T, v...> const& xs, Xs&&, Pred&&) {
+            return filter_impl::keep_elements<true>(xs,
+                tuple_detail::predicate_results<
+                    Pred, decltype(integral_constant<T, v>)&...
+                >{});
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            return filter_impl::helper(tuple_detail::tag_of<Xs>{}, xs,
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
+        }
+    };
+
+    template <>
+    struct remove_if_impl<Tuple> {
+        template <typename ...T, typename Pred>
+        static constexpr auto
+        remove_if_helper(_tuple_t<T...> const& xs, Pred&&, decltype(true_)) {
+            return filter_impl<Tuple>::keep_elements<false>(xs,
+                tuple_detail::type_results<Pred, T...>{});
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        remove_if_helper(Xs&& xs, Pred&& pred, decltype(false_)) {
+            return remove_if_impl<Tuple, when<true>>::apply(
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            constexpr bool is_tuple_t =
+                detail::std::remove_reference<Xs>::type::is_tuple_t;
+            return remove_if_impl::remove_if_helper(static_cast<Xs&&>(xs),
+                static_cast<Pred&&>(pred), bool_<is_tuple_t>);
+        }
+    };
+
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_MONAD_PLUS_HPP
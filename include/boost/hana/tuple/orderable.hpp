@@ -0,0 +1,68 @@
+/*!
+@file
+Defines the model of `boost::hana::Orderable` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_ORDERABLE_HPP
+#define BOOST_HANA_TUPLE_ORDERABLE_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/core/datatype.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/orderable.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/tuple/comparable.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Orderable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct less_impl<Tuple, Tuple> {
+        using Size = detail::std::size_t;
+
+        // The tuples are equal up to the length of the shortest one.
+        template <Size index, typename Xs, typename Ys>
+        static constexpr auto less_at(Xs const&, Ys const&, decltype(true_))
+        { return bool_<(Xs::size < Ys::size)>; }
+
+        // The tuples first differ at `index`.
+        template <Size index, typename Xs, typename Ys>
+        static constexpr decltype(auto)
+        less_at(Xs const& xs, Ys const& ys, decltype(false_))
+        { return hana::less(detail::get<index>(xs), detail::get<index>(ys)); }
+
+        template <bool ...b, typename Xs, typename Ys>
+        static constexpr decltype(auto)
+        less_helper(tuple_detail::bools<b...>, Xs const& xs, Ys const& ys) {
+            constexpr Size index = tuple_detail::bools<b...>::find(false);
+            return less_at<index>(xs, ys, bool_<(index == sizeof...(b))>);
+        }
+
+        template <typename Xs, typename Ys>
+        static constexpr decltype(auto)
+        less_helper(tuple_detail::not_constant, Xs const& xs, Ys const& ys)
+        {
+            return Sequence::less_impl<
+                typename datatype<Xs>::type, typename datatype<Ys>::type
+            >::apply(xs, ys);
+        }
+
+        template <typename Xs, typename Ys>
+        static constexpr decltype(auto) apply(Xs const& xs, Ys const& ys) {
+            constexpr Size n = Xs::size < Ys::size ? Xs::size : Ys::size;
+            return less_helper(
+                tuple_detail::elementwise_equal<Xs, Ys, n>{}, xs, ys
+            );
+        }
+    };
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_ORDERABLE_HPP
@@ -0,0 +1,166 @@
+/*!
+@file
+Defines the model of `boost::hana::Searchable` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_SEARCHABLE_HPP
+#define BOOST_HANA_TUPLE_SEARCHABLE_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/constexpr/algorithm.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/maybe.hpp>
+#include <boost/hana/searchable.hpp>
+#include <boost/hana/type.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Searchable
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct find_if_impl<Tuple> {
+        using Size = detail::std::size_t;
+
+        template <Size index, typename Xs>
+        static constexpr auto find_helper(Xs&& xs, decltype(true_)) {
+            //! @todo
+            //! Must we actually call `pred` to make sure potential
+            //! side effects are performed?
+            return hana::just(detail::get<index>(static_cast<Xs&&>(xs)));
+        }
+
+        template <Size index, typename Xs>
+        static constexpr auto find_helper(Xs&&, decltype(false_))
+        { return hana::nothing; }
+
+        template <typename ...E, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(tuple_detail::closure_tag, detail::closure_impl<E...> const&,
+               Xs&& xs, Pred&&)
+        {
+            using Results = tuple_detail::predicate_results<
+                Pred, tuple_detail::element_t<Xs, typename E::get_type>...
+            >;
+            constexpr Size index = Results::find(true);
+            return find_if_impl::find_helper<index>(static_cast<Xs&&>(xs),
+                                        bool_<(index != sizeof...(E))>);
+        }
+
+        template <typename ...T, typename Xs, typename Pred>
+        static constexpr auto
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const& xs, Xs&&, Pred&&) {
+            using Results = tuple_detail::type_results<Pred, T...>;
+            constexpr Size index = Results::find(true);
+            return find_if_impl::find_helper<index>(xs,
+                                        bool_<(index != sizeof...(T))>);
+        }
+
+        template <typename T, T ...v, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(tuple_detail::tuple_c_tag, _tuple_c<T, v...> const&, Xs&&, Pred&& pred) {
+            auto const& storage = tuple_detail::storage_of<_tuple_c<T, v...>>;
+            return find_if_impl::helper(tuple_detail::closure_tag{}, storage,
+                                        storage, static_cast<Pred&&>(pred));
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            return find_if_impl::helper(tuple_detail::tag_of<Xs>{}, xs,
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
+        }
+    };
+
+    template <>
+    struct any_of_impl<Tuple> {
+        template <bool ...b, typename Xs, typename Pred>
+        static constexpr auto
+        any_of_helper(tuple_detail::bools<b...>, Xs&&, Pred&&) {
+            return bool_<(tuple_detail::bools<b...>::find(true)
+                                                    != sizeof...(b))>;
+        }
+
+        // Some results are not known at compile-time; use the default
+        // implementation, which supports that.
+        template <typename Xs, typename Pred>
+        static constexpr auto
+        any_of_helper(tuple_detail::not_constant, Xs&& xs, Pred&& pred) {
+            return Iterable::any_of_impl<Tuple>::apply(
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            return any_of_impl::any_of_helper(
+                tuple_detail::constant_results_of_t<Pred, Xs>{},
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred)
+            );
+        }
+    };
+
+    template <>
+    struct all_of_impl<Tuple> {
+        template <bool ...b, typename Xs, typename Pred>
+        static constexpr auto
+        all_of_helper(tuple_detail::bools<b...>, Xs&&, Pred&&) {
+            return bool_<(tuple_detail::bools<b...>::find(false)
+                                                    == sizeof...(b))>;
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        all_of_helper(tuple_detail::not_constant, Xs&& xs, Pred&& pred) {
+            return all_of_impl<Tuple, when<true>>::apply(
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            return all_of_impl::all_of_helper(
+                tuple_detail::constant_results_of_t<Pred, Xs>{},
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred)
+            );
+        }
+    };
+
+    template <>
+    struct contains_impl<Tuple> {
+        // Looking for a `Type` in a `tuple_t` only compares the types.
+        template <typename ...T, typename U>
+        static constexpr auto
+        contains_helper(_tuple_t<T...> const&, _type<U> const&, decltype(true_)) {
+            constexpr bool same[] = {false, detail::std::is_same<T, U>::value...};
+            return bool_<detail::constexpr_::count(
+                same, same + sizeof(same), true) != 0>;
+        }
+
+        template <typename Xs, typename X>
+        static constexpr decltype(auto)
+        contains_helper(Xs&& xs, X&& x, decltype(false_)) {
+            return contains_impl<Tuple, when<true>>::apply(
+                static_cast<Xs&&>(xs), static_cast<X&&>(x));
+        }
+
+        template <typename Xs, typename X>
+        static constexpr decltype(auto) apply(Xs&& xs, X&& x) {
+            constexpr bool types =
+                detail::std::remove_reference<Xs>::type::is_tuple_t &&
+                detail::std::is_same<typename datatype<X>::type, Type>::value;
+            return contains_impl::contains_helper(static_cast<Xs&&>(xs),
+                static_cast<X&&>(x), bool_<types>);
+        }
+    };
+
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_SEARCHABLE_HPP
@@ -0,0 +1,816 @@
+/*!
+@file
+Defines the model of `boost::hana::Sequence` for `boost::hana::Tuple`.
+
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TUPLE_SEQUENCE_HPP
+#define BOOST_HANA_TUPLE_SEQUENCE_HPP
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/bool.hpp>
+#include <boost/hana/constant.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/detail/constexpr/algorithm.hpp>
+#include <boost/hana/detail/constexpr/array.hpp>
+#include <boost/hana/detail/generate_integer_sequence.hpp>
+#include <boost/hana/detail/std/conditional.hpp>
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/declval.hpp>
+#include <boost/hana/detail/std/enable_if.hpp>
+#include <boost/hana/detail/std/integer_sequence.hpp>
+#include <boost/hana/detail/std/move.hpp>
+#include <boost/hana/detail/std/size_t.hpp>
+#include <boost/hana/detail/variadic/at.hpp>
+#include <boost/hana/functional/apply.hpp>
+#include <boost/hana/functional/curry.hpp>
+#include <boost/hana/logical.hpp>
+#include <boost/hana/orderable.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/sequence.hpp>
+#include <boost/hana/tuple/monad_plus.hpp>
+
+
+namespace boost { namespace hana {
+    //////////////////////////////////////////////////////////////////////////
+    // Sequence
+    //////////////////////////////////////////////////////////////////////////
+    template <>
+    struct models_impl<Sequence, Tuple>
+        : decltype(true_)
+    { };
+
+    namespace tuple_detail {
+        // `b...` tells whether each pair of adjacent elements is in the
+        // same group. These generators compute the index at which each
+        // group starts and ends, respectively.
+        template <typename Results>
+        struct GroupStarts;
+
+        template <bool ...b>
+        struct GroupStarts<bools<b...>> {
+            template <typename Array>
+            constexpr auto operator()(Array indices) const {
+                constexpr bool same_group[sizeof...(b)+1] = {b...};
+                //                                    ^ avoid empty array
+                detail::std::size_t group = 1;
+                for (detail::std::size_t i = 0; i != sizeof...(b); ++i)
+                    if (!same_group[i])
+                        indices[group++] = i + 1;
+                indices[0] = 0;
+                return indices;
+            }
+        };
+
+        template <typename Results>
+        struct GroupEnds;
+
+        template <bool ...b>
+        struct GroupEnds<bools<b...>> {
+            template <typename Array>
+            constexpr auto operator()(Array indices) const {
+                constexpr bool same_group[sizeof...(b)+1] = {b...};
+                //                                    ^ avoid empty array
+                detail::std::size_t group = 0;
+                for (detail::std::size_t i = 0; i != sizeof...(b); ++i)
+                    if (!same_group[i])
+                        indices[group++] = i + 1;
+                indices[group] = sizeof...(b) + 1;
+                return indices;
+            }
+        };
+    }
+
+    template <>
+    struct group_pred_impl<Tuple> {
+        using Size = detail::std::size_t;
+
+        template <typename Xs, Size ...start, Size ...end>
+        static constexpr decltype(auto)
+        group_helper(Xs&& xs, detail::std::index_sequence<start...>,
+                              detail::std::index_sequence<end...>)
+        {
+            return hana::make<Tuple>(tuple_detail::slice<start>(
+                static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<end - start>{}
+            )...);
+        }
+
+        // The predicate is only called on adjacent elements.
+        template <typename Xs, typename Pred, Size ...i>
+        static constexpr decltype(auto)
+        group_adjacent(Xs&& xs, Pred&&, detail::std::index_sequence<i...>) {
+            using Results = tuple_detail::bools<
+                hana::if_(hana::value<decltype(
+                    detail::std::declval<Pred&>()(
+                        detail::get<i>(static_cast<Xs&&>(xs)),
+                        detail::get<i + 1>(static_cast<Xs&&>(xs))
+                    )
+                )>(), true, false)...
+            >;
+            constexpr Size size = tuple_detail::size<Xs>{};
+            constexpr Size groups = size == 0 ? 0 : Results::count(false) + 1;
+            return group_helper(static_cast<Xs&&>(xs),
+                detail::generate_index_sequence<
+                    groups, tuple_detail::GroupStarts<Results>
+                >{},
+                detail::generate_index_sequence<
+                    groups, tuple_detail::GroupEnds<Results>
+                >{}
+            );
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            constexpr Size size = tuple_detail::size<Xs>{};
+            return group_adjacent(static_cast<Xs&&>(xs),
+                static_cast<Pred&&>(pred),
+                detail::std::make_index_sequence<(size > 0 ? size - 1 : 0)>{});
+        }
+    };
+
+    template <>
+    struct init_impl<Tuple> {
+        template <typename Xs, detail::std::size_t ...n>
+        static constexpr decltype(auto)
+        init_helper(Xs&& xs, detail::std::index_sequence<n...>) {
+            return hana::make<Tuple>(
+                        detail::get<n>(static_cast<Xs&&>(xs))...);
+        }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            constexpr detail::std::size_t size = tuple_detail::size<Xs>{};
+            return init_helper(static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<size - 1>{});
+        }
+    };
+
+    template <>
+    struct intersperse_impl<Tuple> {
+        template <detail::std::size_t i, typename Z, typename Xs>
+        static constexpr Z pick(Z&& z, Xs const&,
+            decltype(false_) /* odd index */)
+        { return static_cast<Z&&>(z); }
+
+        template <detail::std::size_t i, typename Z, typename Xn>
+        static constexpr Xn const&
+        pick(Z const&, detail::element<(i + 1) / 2, Xn> const& x,
+            decltype(true_) /* even index */)
+        { return detail::get<(i + 1) / 2>(x); }
+
+        template <detail::std::size_t i, typename Z, typename Xn>
+        static constexpr Xn&&
+        pick(Z const&, detail::element<(i + 1) / 2, Xn>&& x,
+            decltype(true_) /* even index */)
+        {
+            return detail::get<(i + 1) / 2>(
+                static_cast<detail::element<(i + 1) / 2, Xn>&&>(x));
+        }
+
+        template <typename Xs, typename Z, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        intersperse_helper(Xs&& xs, Z&& z, detail::std::index_sequence<i...>) {
+            return hana::make<Tuple>(
+                pick<i>(
+                    static_cast<Z&&>(z),
+                    static_cast<Xs&&>(xs),
+                    bool_<(i % 2 == 0)>
+                )...
+            );
+        }
+
+        template <typename Xs, typename Z>
+        static constexpr decltype(auto) apply(Xs&& xs, Z&& z) {
+            constexpr detail::std::size_t size = tuple_detail::size<Xs>{};
+            constexpr auto new_seq_size = size == 0 ? 0 : (size * 2) - 1;
+            return intersperse_helper(
+                          tuple_detail::storage(static_cast<Xs&&>(xs)),
+                          static_cast<Z&&>(z),
+                          detail::std::make_index_sequence<new_seq_size>{});
+        }
+    };
+
+    template <>
+    struct partition_impl<Tuple> {
+        template <typename Xs, detail::std::size_t ...left,
+                               detail::std::size_t ...right>
+        static constexpr decltype(auto)
+        partition_helper(Xs&& xs, detail::std::index_sequence<left...>,
+                                  detail::std::index_sequence<right...>)
+        {
+            return hana::make<Pair>(
+                hana::make<Tuple>(detail::get<left>(static_cast<Xs&&>(xs))...),
+                hana::make<Tuple>(detail::get<right>(static_cast<Xs&&>(xs))...)
+            );
+        }
+
+        template <typename ...E, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(tuple_detail::closure_tag, detail::closure_impl<E...> const&,
+               Xs&& xs, Pred&&)
+        {
+            using Results = tuple_detail::predicate_results<
+                Pred, tuple_detail::element_t<Xs, typename E::get_type>...
+            >;
+            return partition_impl::partition_helper(static_cast<Xs&&>(xs),
+                detail::generate_index_sequence<Results::count(true),
+                    tuple_detail::IndicesOf<Results, true>
+                >{},
+                detail::generate_index_sequence<Results::count(false),
+                    tuple_detail::IndicesOf<Results, false>
+                >{}
+            );
+        }
+
+        template <typename ...T, typename Xs, typename Pred>
+        static constexpr auto
+        helper(tuple_detail::tuple_t_tag, _tuple_t<T...> const&, Xs&&, Pred&&) {
+            using Results = tuple_detail::type_results<Pred, T...>;
+            return hana::make<Pair>(
+                partition_impl::types<T...>(
+                    detail::generate_index_sequence<Results::count(true),
+                        tuple_detail::IndicesOf<Results, true>
+                    >{}),
+                partition_impl::types<T...>(
+                    detail::generate_index_sequence<Results::count(false),
+                        tuple_detail::IndicesOf<Results, false>
+                    >{})
+            );
+        }
+
+        template <typename ...T, detail::std::size_t ...i>
+        static constexpr auto types(detail::std::index_sequence<i...>)
+        { return tuple_t<detail::variadic::at_t<i, T...>...>; }
+
+        template <typename T, T ...v, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(tuple_detail::tuple_c_tag, _tuple_c<T, v...> const&, Xs&&, Pred&& pred) {
+            auto const& storage = tuple_detail::storage_of<_tuple_c<T, v...>>;
+            return partition_impl::helper(tuple_detail::closure_tag{}, storage,
+                                          storage, static_cast<Pred&&>(pred));
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            return partition_impl::helper(tuple_detail::tag_of<Xs>{}, xs,
+                static_cast<Xs&&>(xs), static_cast<Pred&&>(pred));
+        }
+    };
+
+    namespace tuple_detail {
+        template <detail::std::size_t N>
+        constexpr auto permutation_indices =
+            detail::constexpr_::array<detail::std::size_t, N>{}.iota(0)
+                                                               .permutations();
+    }
+
+    template <>
+    struct permutations_impl<Tuple> {
+        using Size = detail::std::size_t;
+
+        template <Size n, typename Xs, Size ...i>
+        static constexpr auto
+        nth_permutation(Xs const& xs, detail::std::index_sequence<i...>) {
+            return hana::make<Tuple>(
+                detail::get<tuple_detail::permutation_indices<Xs::size>[n][i]>(xs)...
+            );
+        }
+
+        template <typename Xs, Size ...n>
+        static constexpr auto
+        permutations_helper(Xs const& xs, detail::std::index_sequence<n...>) {
+            return hana::make<Tuple>(
+                nth_permutation<n>(
+                    xs, detail::std::make_index_sequence<Xs::size>{}
+                )...
+            );
+        }
+
+        template <typename Xs>
+        static constexpr auto apply(Xs const& xs) {
+            constexpr Size total_permutations =
+                detail::constexpr_::factorial(Xs::size);
+            return permutations_helper(xs,
+                detail::std::make_index_sequence<total_permutations>{}
+            );
+        }
+    };
+
+    template <>
+    struct remove_at_impl<Tuple> {
+        using Size = detail::std::size_t;
+
+        template <typename Xs, Size ...before, Size ...after>
+        static constexpr decltype(auto)
+        remove_at_helper(Xs&& xs, detail::std::index_sequence<before...>,
+                                  detail::std::index_sequence<after...>)
+        {
+            return hana::make<Tuple>(
+                detail::get<before>(
+                    static_cast<Xs&&>(xs)
+                )...,
+                detail::get<sizeof...(before) + after + 1>(
+                    static_cast<Xs&&>(xs)
+                )...
+            );
+        }
+
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N const&, Xs&& xs) {
+            constexpr Size index = hana::value<N>();
+            constexpr Size size = tuple_detail::size<Xs>{};
+            return remove_at_helper(static_cast<Xs&&>(xs),
+                          detail::std::make_index_sequence<index>{},
+                          detail::std::make_index_sequence<size - index - 1>{});
+        }
+    };
+
+    template <>
+    struct reverse_impl<Tuple> {
+        template <detail::std::size_t ...n, typename ...Xn>
+        static constexpr decltype(auto)
+        apply(detail::closure_impl<detail::element<n, Xn>...>&& xs) {
+            using Closure = detail::closure_impl<detail::element<n, Xn>...>;
+            return hana::make<Tuple>(detail::get<sizeof...(n) - n - 1>(
+                                            static_cast<Closure&&>(xs))...);
+        }
+
+        template <detail::std::size_t ...n, typename ...Xn>
+        static constexpr decltype(auto)
+        apply(detail::closure_impl<detail::element<n, Xn>...> const& xs) {
+            return hana::make<Tuple>(detail::get<sizeof...(n) - n - 1>(xs)...);
+        }
+
+        template <typename Xs, typename = detail::std::
+            enable_if_t<tuple_detail::is_type_list<Xs>{}()>>
+        static constexpr decltype(auto) apply(Xs const& xs)
+        { return reverse_impl::apply(tuple_detail::storage(xs)); }
+    };
+
+    template <>
+    struct slice_impl<Tuple> {
+        template <detail::std::size_t from, typename Xs, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        slice_helper(Xs&& xs, detail::std::index_sequence<i...>) {
+            return hana::make<Tuple>(detail::get<from + i>(
+                                        static_cast<Xs&&>(xs))...);
+        }
+
+        template <typename Xs, typename From, typename To>
+        static constexpr decltype(auto) apply(Xs&& xs, From const&, To const&) {
+            constexpr detail::std::size_t from = hana::value<From>();
+            constexpr detail::std::size_t to = hana::value<To>();
+            return slice_helper<from>(static_cast<Xs&&>(xs),
+                                detail::std::make_index_sequence<to - from>{});
+        }
+    };
+
+    template <>
+    struct sort_impl<Tuple> {
+        template <typename T, T ...v, detail::std::size_t ...i>
+        static constexpr auto
+        sort_helper(_tuple_c<T, v...> const& /*xs*/,
+                    detail::std::index_sequence<i...>)
+        {
+            constexpr detail::constexpr_::array<T, sizeof...(v)> a{{v...}};
+            constexpr auto result = a.sort();
+            return tuple_c<T, result[i]...>;
+        }
+
+        template <typename ...T>
+        static constexpr decltype(auto) apply(_tuple<T...> const& xs)
+        { return hana::sort(xs, less); }
+
+        template <typename ...T>
+        static constexpr decltype(auto) apply(_tuple<T...>&& xs)
+        { return hana::sort(detail::std::move(xs), less); }
+
+        template <typename ...T>
+        static constexpr decltype(auto) apply(_tuple_t<T...> const& xs)
+        { return hana::sort(xs, less); }
+
+        template <typename T, T ...v>
+        static constexpr auto apply(_tuple_c<T, v...> const& xs) {
+            return sort_helper(xs,
+                    detail::std::make_index_sequence<sizeof...(v)>{});
+        }
+    };
+
+    namespace tuple_detail {
+        // The permutation sorting a tuple is computed with a merge sort
+        // working on lists of indices. Only the comparisons required by
+        // the merge sort are instantiated, and the sorted tuple is created
+        // with a single expansion, without any intermediate tuple.
+        //
+        // `Less::less<i, j>()` tells whether the `i`-th element is less
+        // than the `j`-th element.
+        template <typename Less>
+        struct merge_sort {
+            template <typename Left, typename Right, typename Merged>
+            struct merge;
+
+            template <detail::std::size_t ...r, detail::std::size_t ...m>
+            struct merge<detail::std::index_sequence<>,
+                         detail::std::index_sequence<r...>,
+                         detail::std::index_sequence<m...>>
+            { using type = detail::std::index_sequence<m..., r...>; };
+
+            template <detail::std::size_t l, detail::std::size_t ...ls,
+                      detail::std::size_t ...m>
+            struct merge<detail::std::index_sequence<l, ls...>,
+                         detail::std::index_sequence<>,
+                         detail::std::index_sequence<m...>>
+            { using type = detail::std::index_sequence<m..., l, ls...>; };
+
+            // Elements of the right half are only moved before elements of
+            // the left half when they are strictly less, which makes the
+            // sort stable.
+            template <detail::std::size_t l, detail::std::size_t ...ls,
+                      detail::std::size_t r, detail::std::size_t ...rs,
+                      detail::std::size_t ...m>
+            struct merge<detail::std::index_sequence<l, ls...>,
+                         detail::std::index_sequence<r, rs...>,
+                         detail::std::index_sequence<m...>>
+                : detail::std::conditional<Less::template less<r, l>(),
+                    merge<detail::std::index_sequence<l, ls...>,
+                          detail::std::index_sequence<rs...>,
+                          detail::std::index_sequence<m..., r>>,
+                    merge<detail::std::index_sequence<ls...>,
+                          detail::std::index_sequence<r, rs...>,
+                          detail::std::index_sequence<m..., l>>
+                >::type
+            { };
+
+            template <detail::std::size_t first, detail::std::size_t last,
+                      bool = (last - first > 1)>
+            struct sort {
+                static constexpr detail::std::size_t middle =
+                    first + (last - first) / 2;
+                using type = typename merge<
+                    typename sort<first, middle>::type,
+                    typename sort<middle, last>::type,
+                    detail::std::index_sequence<>
+                >::type;
+            };
+
+            template <detail::std::size_t first, detail::std::size_t last>
+            struct sort<first, last, false> {
+                using type = typename detail::std::conditional<(first < last),
+                    detail::std::index_sequence<first>,
+                    detail::std::index_sequence<>
+                >::type;
+            };
+        };
+
+        // Compares the elements of `Xs` by calling `Pred` on them.
+        template <typename Xs, typename Pred>
+        struct sort_by {
+            template <detail::std::size_t i>
+            using element = decltype(
+                detail::get<i>(detail::std::declval<Xs>())
+            );
+
+            template <detail::std::size_t i, detail::std::size_t j>
+            static constexpr bool less() {
+                return hana::if_(hana::value<decltype(
+                    detail::std::declval<Pred>()(
+                        detail::std::declval<element<i>>(),
+                        detail::std::declval<element<j>>()
+                    )
+                )>(), true, false);
+            }
+        };
+
+        // Compares the types of a `tuple_t` with a trait like `trait<F>`,
+        // without creating any `Type` nor calling the predicate.
+        template <typename F, typename ...T>
+        struct sort_types_by {
+            template <detail::std::size_t i, detail::std::size_t j>
+            static constexpr bool less() {
+                return static_cast<bool>(F::template apply<
+                    detail::variadic::at_t<i, T...>,
+                    detail::variadic::at_t<j, T...>
+                >::type::value);
+            }
+        };
+
+        // Only declared; the `_tuple_t` a `tuple_t` derives from, or
+        // `not_constant` for any other tuple.
+        template <typename ...T>
+        _tuple_t<T...> types_of(_tuple_t<T...> const&);
+
+        not_constant types_of(...);
+
+        template <typename Xs, typename Pred, typename Types =
+            decltype(tuple_detail::types_of(detail::std::declval<Xs>())),
+            typename Decayed = typename detail::std::decay<Pred>::type>
+        struct sort_less {
+            using type = sort_by<Xs, Pred>;
+        };
+
+        template <typename Xs, typename Pred, typename ...T, typename F>
+        struct sort_less<Xs, Pred, _tuple_t<T...>, _integral<F>> {
+            using type = sort_types_by<F, T...>;
+        };
+    }
+
+    template <>
+    struct sort_pred_impl<Tuple> {
+        template <typename Xs, detail::std::size_t ...i>
+        static constexpr decltype(auto)
+        sort_helper(Xs&& xs, detail::std::index_sequence<i...>,
+                    tuple_detail::not_constant)
+        { return hana::make<Tuple>(detail::get<i>(static_cast<Xs&&>(xs))...); }
+
+        // A sorted `tuple_t` is also a `tuple_t`.
+        template <typename Xs, detail::std::size_t ...i, typename ...T>
+        static constexpr auto
+        sort_helper(Xs&&, detail::std::index_sequence<i...>, _tuple_t<T...>)
+        { return tuple_t<detail::variadic::at_t<i, T...>...>; }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&&) {
+            constexpr detail::std::size_t n = tuple_detail::size<Xs>{};
+            using Less = typename tuple_detail::sort_less<Xs, Pred>::type;
+            using Indices = typename tuple_detail::merge_sort<Less>::
+                            template sort<0, n>::type;
+            return sort_helper(static_cast<Xs&&>(xs), Indices{},
+                decltype(tuple_detail::types_of(static_cast<Xs&&>(xs))){});
+        }
+    };
+
+    template <>
+    struct span_impl<Tuple> {
+        template <typename ...E, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(detail::closure_impl<E...> const&, Xs&& xs, Pred&&) {
+            using Results = tuple_detail::predicate_results<
+                Pred, tuple_detail::element_t<Xs, typename E::get_type>...
+            >;
+            constexpr detail::std::size_t n = Results::find(false);
+            return hana::make<Pair>(
+                tuple_detail::slice<0>(static_cast<Xs&&>(xs),
+                    detail::std::make_index_sequence<n>{}),
+                tuple_detail::slice<n>(static_cast<Xs&&>(xs),
+                    detail::std::make_index_sequence<sizeof...(E) - n>{})
+            );
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            return span_impl::helper(tuple_detail::storage(xs),
+                tuple_detail::storage(static_cast<Xs&&>(xs)),
+                static_cast<Pred&&>(pred));
+        }
+    };
+
+    template <>
+    struct take_at_most_impl<Tuple> {
+        template <typename Xs, detail::std::size_t ...n>
+        static constexpr decltype(auto)
+        take_helper(Xs&& xs, detail::std::index_sequence<n...>) {
+            return hana::make<Tuple>(detail::get<n>(
+                                            static_cast<Xs&&>(xs))...);
+        }
+
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N const&, Xs&& xs) {
+            constexpr detail::std::size_t n = hana::value<N>();
+            constexpr detail::std::size_t size = tuple_detail::size<Xs>{};
+            return take_helper(static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<(n < size ? n : size)>{});
+        }
+    };
+
+    template <>
+    struct take_until_impl<Tuple> {
+        template <typename ...E, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(detail::closure_impl<E...> const&, Xs&& xs, Pred&&) {
+            using Results = tuple_detail::predicate_results<
+                Pred, tuple_detail::element_t<Xs, typename E::get_type>...
+            >;
+            return tuple_detail::slice<0>(static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<Results::find(true)>{});
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            return take_until_impl::helper(tuple_detail::storage(xs),
+                tuple_detail::storage(static_cast<Xs&&>(xs)),
+                static_cast<Pred&&>(pred));
+        }
+    };
+
+    template <>
+    struct take_while_impl<Tuple> {
+        template <typename ...E, typename Xs, typename Pred>
+        static constexpr decltype(auto)
+        helper(detail::closure_impl<E...> const&, Xs&& xs, Pred&&) {
+            using Results = tuple_detail::predicate_results<
+                Pred, tuple_detail::element_t<Xs, typename E::get_type>...
+            >;
+            return tuple_detail::slice<0>(static_cast<Xs&&>(xs),
+                detail::std::make_index_sequence<Results::find(false)>{});
+        }
+
+        template <typename Xs, typename Pred>
+        static constexpr decltype(auto) apply(Xs&& xs, Pred&& pred) {
+            return take_while_impl::helper(tuple_detail::storage(xs),
+                tuple_detail::storage(static_cast<Xs&&>(xs)),
+                static_cast<Pred&&>(pred));
+        }
+    };
+
+    template <>
+    struct unzip_impl<Tuple> {
+        template <typename ...E, typename Xs>
+        static constexpr decltype(auto)
+        helper(detail::closure_impl<E...> const&, Xs&& xs) {
+            return hana::zip(detail::get(
+                static_cast<tuple_detail::element_t<Xs, E>>(xs))...);
+        }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            return unzip_impl::helper(tuple_detail::storage(xs),
+                tuple_detail::storage(static_cast<Xs&&>(xs)));
+        }
+    };
+
+    template <>
+    struct zip_unsafe_with_impl<Tuple> {
+        template <typename F, typename ...E, typename Xs>
+        static constexpr decltype(auto)
+        helper(F&& f, detail::closure_impl<E...> const&, Xs&& xs) {
+            return hana::make<Tuple>(
+                f(detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs)))...
+            );
+        }
+
+        template <typename F, typename ...E, typename ...G,
+                  typename Xs, typename Ys>
+        static constexpr decltype(auto)
+        helper(F&& f, detail::closure_impl<E...> const&,
+                      detail::closure_impl<G...> const&, Xs&& xs, Ys&& ys)
+        {
+            return hana::make<Tuple>(
+                f(detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs)),
+                  detail::get(static_cast<tuple_detail::element_t<Ys, G>>(ys)))...
+            );
+        }
+
+        template <typename F, typename ...E, typename ...G, typename ...H,
+                  typename Xs, typename Ys, typename Zs>
+        static constexpr decltype(auto)
+        helper(F&& f, detail::closure_impl<E...> const&,
+                      detail::closure_impl<G...> const&,
+                      detail::closure_impl<H...> const&,
+                      Xs&& xs, Ys&& ys, Zs&& zs)
+        {
+            return hana::make<Tuple>(
+                f(detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs)),
+                  detail::get(static_cast<tuple_detail::element_t<Ys, G>>(ys)),
+                  detail::get(static_cast<tuple_detail::element_t<Zs, H>>(zs)))...
+            );
+        }
+
+        template <typename F, typename Xs>
+        static constexpr decltype(auto) apply(F&& f, Xs&& xs) {
+            return zip_unsafe_with_impl::helper(static_cast<F&&>(f),
+                tuple_detail::storage(xs),
+                tuple_detail::storage(static_cast<Xs&&>(xs)));
+        }
+
+        template <typename F, typename Xs, typename Ys>
+        static constexpr decltype(auto) apply(F&& f, Xs&& xs, Ys&& ys) {
+            return zip_unsafe_with_impl::helper(static_cast<F&&>(f),
+                tuple_detail::storage(xs), tuple_detail::storage(ys),
+                tuple_detail::storage(static_cast<Xs&&>(xs)),
+                tuple_detail::storage(static_cast<Ys&&>(ys)));
+        }
+
+        template <typename F, typename Xs, typename Ys, typename Zs>
+        static constexpr decltype(auto) apply(F&& f, Xs&& xs, Ys&& ys, Zs&& zs) {
+            return zip_unsafe_with_impl::helper(static_cast<F&&>(f),
+                tuple_detail::storage(xs), tuple_detail::storage(ys),
+                tuple_detail::storage(zs),
+                tuple_detail::storage(static_cast<Xs&&>(xs)),
+                tuple_detail::storage(static_cast<Ys&&>(ys)),
+                tuple_detail::storage(static_cast<Zs&&>(zs)));
+        }
+
+        template <typename F, typename X1, typename X2, typename X3, typename X4, typename ...Xn>
+        static constexpr decltype(auto)
+        apply(F&& f, X1&& x1, X2&& x2, X3&& x3, X4&& x4, Xn&& ...xn) {
+            return apply(hana::apply,
+                apply(
+                    curry<sizeof...(xn) + 4>(static_cast<F&&>(f)),
+                    static_cast<X1&&>(x1),
+                    static_cast<X2&&>(x2),
+                    static_cast<X3&&>(x3)
+                ),
+                static_cast<X4&&>(x4),
+                static_cast<Xn&&>(xn)...
+            );
+        }
+    };
+
+    template <>
+    struct zip_unsafe_impl<Tuple> {
+        template <typename ...E, typename Xs>
+        static constexpr _tuple<
+            _tuple<typename E::get_type>...
+        > helper(detail::closure_impl<E...> const&, Xs&& xs) {
+            return {
+                _tuple<typename E::get_type>{
+                    detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs))
+                }...
+            };
+        }
+
+        template <typename ...E, typename ...G, typename Xs, typename Ys>
+        static constexpr _tuple<
+            _tuple<typename E::get_type, typename G::get_type>...
+        > helper(detail::closure_impl<E...> const&,
+                 detail::closure_impl<G...> const&, Xs&& xs, Ys&& ys)
+        {
+            return {
+                _tuple<typename E::get_type, typename G::get_type>{
+                    detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs)),
+                    detail::get(static_cast<tuple_detail::element_t<Ys, G>>(ys))
+                }...
+            };
+        }
+
+        template <typename ...E, typename ...G, typename ...H,
+                  typename Xs, typename Ys, typename Zs>
+        static constexpr _tuple<
+            _tuple<typename E::get_type,
+                   typename G::get_type,
+                   typename H::get_type>...
+        > helper(detail::closure_impl<E...> const&,
+                 detail::closure_impl<G...> const&,
+                 detail::closure_impl<H...> const&,
+                 Xs&& xs, Ys&& ys, Zs&& zs)
+        {
+            return {
+                _tuple<typename E::get_type,
+                       typename G::get_type,
+                       typename H::get_type>{
+                    detail::get(static_cast<tuple_detail::element_t<Xs, E>>(xs)),
+                    detail::get(static_cast<tuple_detail::element_t<Ys, G>>(ys)),
+                    detail::get(static_cast<tuple_detail::element_t<Zs, H>>(zs))
+                }...
+            };
+        }
+
+        template <typename Xs>
+        static constexpr decltype(auto) apply(Xs&& xs) {
+            return zip_unsafe_impl::helper(tuple_detail::storage(xs),
+                tuple_detail::storage(static_cast<Xs&&>(xs)));
+        }
+
+        template <typename Xs, typename Ys>
+        static constexpr decltype(auto) apply(Xs&& xs, Ys&& ys) {
+            return zip_unsafe_impl::helper(
+                tuple_detail::storage(xs), tuple_detail::storage(ys),
+                tuple_detail::storage(static_cast<Xs&&>(xs)),
+                tuple_detail::storage(static_cast<Ys&&>(ys)));
+        }
+
+        template <typename Xs, typename Ys, typename Zs>
+        static constexpr decltype(auto) apply(Xs&& xs, Ys&& ys, Zs&& zs) {
+            return zip_unsafe_impl::helper(
+                tuple_detail::storage(xs), tuple_detail::storage(ys),
+                tuple_detail::storage(zs),
+                tuple_detail::storage(static_cast<Xs&&>(xs)),
+                tuple_detail::storage(static_cast<Ys&&>(ys)),
+                tuple_detail::storage(static_cast<Zs&&>(zs)));
+        }
+
+        template <typename X1, typename X2, typename X3, typename X4, typename ...Xn>
+        static constexpr decltype(auto)
+        apply(X1&& x1, X2&& x2, X3&& x3, X4&& x4, Xn&& ...xn) {
+            return hana::zip.with(concat,
+                apply(
+                    static_cast<X1&&>(x1),
+                    static_cast<X2&&>(x2),
+                    static_cast<X3&&>(x3)
+                ),
+                apply(
+                    static_cast<X4&&>(x4),
+                    static_cast<Xn&&>(xn)...
+                )
+            );
+        }
+    };
+
+}} // end namespace boost::hana
+
+#endif // !BOOST_HANA_TUPLE_SEQUENCE_HPP
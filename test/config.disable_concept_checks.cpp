@@ -0,0 +1,36 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+#   define BOOST_HANA_CONFIG_DISABLE_CONCEPT_CHECKS
+#endif
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/integral_constant.hpp>
+using namespace boost::hana;
+
+
+// `Container` only provides `length`, which is not enough to be `Foldable`.
+// Calling `length` on it would trigger a static assertion if the concept
+// checks were enabled.
+struct Container;
+
+struct container { struct hana { using datatype = Container; }; };
+
+namespace boost { namespace hana {
+    template <>
+    struct length_impl<Container> {
+        static constexpr auto apply(container const&)
+        { return size_t<3>; }
+    };
+}}
+
+static_assert(!_models<Foldable, Container>{}, "");
+
+int main() {
+    BOOST_HANA_CONSTANT_CHECK(equal(length(container{}), size_t<3>));
+}
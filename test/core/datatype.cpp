@@ -50,6 +50,18 @@ namespace boost { namespace hana {
 template struct test<FullySpecialized, FullySpecializedDatatype>;
 
 
+// A full specialization takes precedence over a nested `hana::datatype`.
+struct NestedAndSpecializedDatatype;
+struct NestedAndSpecialized { struct hana { struct datatype; }; };
+namespace boost { namespace hana {
+    template <>
+    struct datatype<NestedAndSpecialized> {
+        using type = NestedAndSpecializedDatatype;
+    };
+}}
+template struct test<NestedAndSpecialized, NestedAndSpecializedDatatype>;
+
+
 struct PartiallySpecializedDatatype;
 template <typename> struct PartiallySpecialized;
 namespace boost { namespace hana {
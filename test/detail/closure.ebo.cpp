@@ -0,0 +1,105 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/detail/closure.hpp>
+#include <boost/hana/functional/capture.hpp>
+#include <boost/hana/functional/compose.hpp>
+#include <boost/hana/functional/demux.hpp>
+#include <boost/hana/functional/lockstep.hpp>
+#include <boost/hana/functional/partial.hpp>
+#include <boost/hana/functional/reverse_partial.hpp>
+#include <boost/hana/lazy.hpp>
+#include <boost/hana/map.hpp>
+#include <boost/hana/pair.hpp>
+#include <boost/hana/set.hpp>
+#include <boost/hana/tuple.hpp>
+using namespace boost::hana;
+
+
+template <int i>
+struct E { };
+
+struct F final { };
+
+template <int i>
+struct f_t {
+    template <typename ...X>
+    constexpr int operator()(X const& ...) const { return 0; }
+};
+
+int main() {
+    // Empty elements do not take any space in a closure.
+    {
+        static_assert(sizeof(detail::closure<E<0>, int>) == sizeof(int), "");
+        static_assert(sizeof(detail::closure<int, E<0>>) == sizeof(int), "");
+        static_assert(sizeof(detail::closure<E<0>, E<1>>) == 1, "");
+        static_assert(sizeof(detail::closure<
+            E<0>, E<1>, E<2>, E<3>, E<4>,
+            E<5>, E<6>, E<7>, E<8>, E<9>, int
+        >) == sizeof(int), "");
+    }
+
+    // Final types can't be derived from, so they are stored as members.
+    {
+        static_assert(sizeof(detail::closure<F, int>) > sizeof(int), "");
+    }
+
+    // Elements are still accessible through detail::get.
+    {
+        detail::closure<E<0>, int, E<1>> xs{E<0>{}, 3, E<1>{}};
+        E<0>& e0 = detail::get<0>(xs); (void)e0;
+        auto const& cxs = xs;
+        E<1> const& e1 = detail::get<2>(cxs); (void)e1;
+        BOOST_HANA_RUNTIME_CHECK(detail::get<1>(xs) == 3);
+    }
+
+    // Tuple and Pair
+    {
+        static_assert(sizeof(_tuple<E<0>, int>) == sizeof(int), "");
+        static_assert(sizeof(_tuple<E<0>, E<1>, int>) == sizeof(int), "");
+        static_assert(sizeof(_pair<E<0>, int>) == sizeof(int), "");
+        static_assert(sizeof(_pair<int, E<0>>) == sizeof(int), "");
+    }
+
+    // Closures stored in a closure are not padded
+    {
+        static_assert(sizeof(_tuple<_tuple<int>>) == sizeof(int), "");
+        static_assert(sizeof(_tuple<_pair<int, int>>) == 2 * sizeof(int), "");
+        static_assert(sizeof(_tuple<_pair<E<0>, int>, int>) == 2 * sizeof(int), "");
+    }
+
+    // Set and Map
+    {
+        static_assert(sizeof(_set<E<0>, int>) == sizeof(int), "");
+        static_assert(sizeof(_set<E<0>, E<1>, int>) == sizeof(int), "");
+
+        static_assert(sizeof(_map<_pair<E<0>, int>>) == sizeof(int), "");
+        static_assert(sizeof(_map<_pair<int, E<0>>>) == sizeof(int), "");
+        static_assert(sizeof(_map<
+            _pair<E<0>, int>, _pair<E<1>, int>
+        >) == 2 * sizeof(int), "");
+    }
+
+    // Function adaptors binding empty objects
+    {
+        constexpr f_t<0> f{};
+        constexpr f_t<1> g{};
+        constexpr f_t<2> h{};
+
+        static_assert(sizeof(partial(f, E<0>{}, 1)) ==
+                      sizeof(partial(f, 1)), "");
+        static_assert(sizeof(reverse_partial(f, E<0>{}, 1)) ==
+                      sizeof(reverse_partial(f, 1)), "");
+        static_assert(sizeof(capture(E<0>{}, 1)) == sizeof(capture(1)), "");
+        static_assert(sizeof(lazy(f)(E<0>{}, 1)) == sizeof(lazy(f)(1)), "");
+        static_assert(sizeof(lockstep(f)(g, h)) == sizeof(lockstep(f)(g)), "");
+        static_assert(sizeof(demux(f)(g, h)) == sizeof(demux(f)(g)), "");
+        static_assert(sizeof(compose(f, g)) == 1, "");
+        static_assert(sizeof(compose(f, g, h)) == 1, "");
+        static_assert(sizeof(compose(f, 1)) == sizeof(int), "");
+    }
+}
@@ -36,9 +36,33 @@ constexpr int constexpr_context() {
     cx::equal(first, last, first, last, equal);
     cx::equal(first, last, first, last);
 
+    cx::insertion_sort(first, last, equal);
+    cx::insertion_sort(first, last);
+
     cx::sort(first, last, equal);
     cx::sort(first, last);
 
+    cx::stable_sort(first, last, equal);
+    cx::stable_sort(first, last);
+
+    cx::heap_sort(first, last, less);
+
+    cx::nth_element(first, first + 2, last, less);
+    cx::nth_element(first, first + 2, last);
+
+    cx::lower_bound(first, last, 3, less);
+    cx::lower_bound(first, last, 3);
+
+    cx::upper_bound(first, last, 3, less);
+    cx::upper_bound(first, last, 3);
+
+    cx::rotate(first, first + 2, last);
+
+    cx::inplace_merge(first, first + 3, last, less);
+
+    cx::unique(first, last, equal);
+    cx::unique(first, last);
+
     cx::find(first, last, 3);
     cx::find_if(first, last, equal.to(3));
 
@@ -46,9 +70,123 @@ constexpr int constexpr_context() {
 
     cx::count(first, last, 2);
 
+    cx::accumulate(first, last, 0, _ + _);
+
+    cx::max_element(first, last, less);
+    cx::max_element(first, last);
+
+    cx::min_element(first, last, less);
+    cx::min_element(first, last);
+
     return 0;
 }
 
 constexpr int must_be_constexpr = constexpr_context();
 
+// The sorting algorithms are not taken from cppreference, so we also check
+// their results on inputs large enough to go through every code path.
+constexpr int N = 200;
+
+constexpr int value(int i) { return (i * 7919) % 97; } // many duplicates
+
+template <typename Sort>
+constexpr bool sorts(Sort sort) {
+    int array[N] = {};
+    for (int i = 0; i != N; ++i)
+        array[i] = value(i);
+    sort(array, array + N);
+    for (int i = 1; i != N; ++i)
+        if (array[i] < array[i - 1])
+            return false;
+    return true;
+}
+
+struct introsort {
+    constexpr void operator()(int* first, int* last) const
+    { cx::sort(first, last); }
+};
+
+struct heap_sort {
+    constexpr void operator()(int* first, int* last) const
+    { cx::heap_sort(first, last, less); }
+};
+
+struct stable_sort {
+    constexpr void operator()(int* first, int* last) const
+    { cx::stable_sort(first, last); }
+};
+
+static_assert(sorts(introsort{}), "");
+static_assert(sorts(heap_sort{}), "");
+static_assert(sorts(stable_sort{}), "");
+
+struct entry { int key, index; };
+
+struct by_key {
+    constexpr bool operator()(entry a, entry b) const
+    { return a.key < b.key; }
+};
+
+constexpr bool stable_sort_is_stable() {
+    entry array[N] = {};
+    for (int i = 0; i != N; ++i)
+        array[i] = entry{value(i) % 10, i};
+    cx::stable_sort(array, array + N, by_key{});
+    for (int i = 1; i != N; ++i) {
+        if (array[i].key < array[i - 1].key)
+            return false;
+        if (array[i].key == array[i - 1].key &&
+            array[i].index < array[i - 1].index)
+            return false;
+    }
+    return true;
+}
+
+static_assert(stable_sort_is_stable(), "");
+
+constexpr bool nth_element_partitions(int n) {
+    int array[N] = {};
+    for (int i = 0; i != N; ++i)
+        array[i] = value(i);
+    cx::nth_element(array, array + n, array + N);
+    for (int i = 0; i != n; ++i)
+        if (array[n] < array[i])
+            return false;
+    for (int i = n + 1; i != N; ++i)
+        if (array[i] < array[n])
+            return false;
+    return true;
+}
+
+static_assert(nth_element_partitions(0), "");
+static_assert(nth_element_partitions(N / 3), "");
+static_assert(nth_element_partitions(N - 1), "");
+
+constexpr bool bounds_and_unique() {
+    int array[] = {0, 1, 1, 1, 3, 3, 5};
+    int* first = array;
+    int* last = array + 7;
+    return cx::lower_bound(first, last, 1) == first + 1
+        && cx::upper_bound(first, last, 1) == first + 4
+        && cx::lower_bound(first, last, 2) == first + 4
+        && cx::upper_bound(first, last, 5) == last
+        && cx::unique(first, last) == first + 4
+        && array[0] == 0 && array[1] == 1 && array[2] == 3 && array[3] == 5;
+}
+
+static_assert(bounds_and_unique(), "");
+
+constexpr bool accumulate_and_extrema() {
+    int array[] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 9, 1};
+    int* first = array;
+    int* last = array + 12;
+    return cx::accumulate(first, last, 0, _ + _) == 49
+        && cx::max_element(first, last) == first + 5
+        && cx::min_element(first, last) == first + 1
+        && cx::max_element(first, first) == first
+        && cx::min_element(first, first) == first;
+}
+
+static_assert(accumulate_and_extrema(), "");
+
 int main() { }
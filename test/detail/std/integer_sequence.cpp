@@ -45,5 +45,28 @@ static_assert(std::is_same<
     detail::std::integer_sequence<int, 0, 1, 2, 3, 4, 5>
 >::value, "");
 
+static_assert(std::is_same<
+    detail::std::make_integer_sequence<unsigned char, 3>,
+    detail::std::integer_sequence<unsigned char, 0, 1, 2>
+>::value, "");
+
+static_assert(std::is_same<
+    detail::std::make_index_sequence<3>,
+    detail::std::index_sequence<0, 1, 2>
+>::value, "");
+
+static_assert(std::is_same<
+    detail::std::index_sequence_for<int, char, void>,
+    detail::std::index_sequence<0, 1, 2>
+>::value, "");
+
+// make sure long sequences can be created
+template <typename T, T ...i>
+constexpr T last(detail::std::integer_sequence<T, i...>) {
+    constexpr T array[] = {i...};
+    return array[sizeof...(i) - 1];
+}
+static_assert(last(detail::std::make_index_sequence<1000>{}) == 999, "");
+static_assert(last(detail::std::make_integer_sequence<int, 1000>{}) == 999, "");
 
 int main() { }
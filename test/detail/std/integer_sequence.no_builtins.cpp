@@ -0,0 +1,9 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+// Make sure the portable implementation works too.
+#define BOOST_HANA_CONFIG_DISABLE_BUILTINS
+#include "integer_sequence.cpp"
@@ -0,0 +1,90 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/detail/std/decay.hpp>
+#include <boost/hana/detail/std/is_arithmetic.hpp>
+#include <boost/hana/detail/std/is_array.hpp>
+#include <boost/hana/detail/std/is_floating_point.hpp>
+#include <boost/hana/detail/std/is_function.hpp>
+#include <boost/hana/detail/std/is_integral.hpp>
+#include <boost/hana/detail/std/is_lvalue_reference.hpp>
+#include <boost/hana/detail/std/is_rvalue_reference.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/detail/std/remove_cv.hpp>
+#include <boost/hana/detail/std/remove_reference.hpp>
+
+#include <type_traits>
+using namespace boost::hana;
+namespace ds = detail::std;
+
+
+struct other { };
+
+// The traits must give the same results as the standard library, whether
+// they are implemented with compiler builtins or not.
+template <typename T>
+struct check {
+    static_assert(ds::is_same<T, T>::value, "");
+    static_assert(!ds::is_same<T, other>::value, "");
+
+    static_assert(std::is_same<
+        typename ds::remove_cv<T>::type,
+        typename std::remove_cv<T>::type
+    >::value, "");
+
+    static_assert(std::is_same<
+        typename ds::remove_reference<T>::type,
+        typename std::remove_reference<T>::type
+    >::value, "");
+
+    static_assert(std::is_same<
+        typename ds::decay<T>::type,
+        typename std::decay<T>::type
+    >::value, "");
+
+    static_assert(ds::is_integral<T>::value == std::is_integral<T>::value, "");
+    static_assert(ds::is_floating_point<T>::value ==
+                  std::is_floating_point<T>::value, "");
+    static_assert(ds::is_arithmetic<T>::value ==
+                  std::is_arithmetic<T>::value, "");
+    static_assert(ds::is_array<T>::value == std::is_array<T>::value, "");
+    static_assert(ds::is_function<T>::value == std::is_function<T>::value, "");
+    static_assert(ds::is_lvalue_reference<T>::value ==
+                  std::is_lvalue_reference<T>::value, "");
+    static_assert(ds::is_rvalue_reference<T>::value ==
+                  std::is_rvalue_reference<T>::value, "");
+};
+
+struct x { };
+
+template struct check<void>;
+template struct check<int>;
+template struct check<int const>;
+template struct check<unsigned long volatile>;
+template struct check<bool const volatile>;
+template struct check<char>;
+template struct check<double const>;
+template struct check<float&>;
+template struct check<x>;
+template struct check<x const&>;
+template struct check<x&&>;
+template struct check<x*>;
+template struct check<x const*>;
+template struct check<int[]>;
+template struct check<int[3]>;
+template struct check<int const(&)[3]>;
+template struct check<void()>;
+template struct check<void(*)()>;
+template struct check<int(&)(char, ...)>;
+template struct check<int x::*>;
+
+static_assert(!ds::is_same<int, int const>::value, "");
+static_assert(!ds::is_same<int, int&>::value, "");
+static_assert(ds::is_same<ds::integral_constant<bool, true>,
+                          ds::true_type>::value, "");
+
+
+int main() { }
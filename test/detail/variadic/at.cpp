@@ -9,6 +9,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/assert.hpp>
 
 #include <laws/base.hpp>
+
+#include <type_traits>
 using namespace boost::hana;
 namespace vd = detail::variadic;
 
@@ -91,4 +93,19 @@ int main() {
     // make sure it works with const objects
     int const i = 1;
     vd::at<0>(i);
+
+    // at_t
+    {
+        static_assert(std::is_same<vd::at_t<0, y<0>>, y<0>>{}, "");
+        static_assert(std::is_same<vd::at_t<0, y<0>, y<1>>, y<0>>{}, "");
+        static_assert(std::is_same<vd::at_t<1, y<0>, y<1>>, y<1>>{}, "");
+        static_assert(std::is_same<vd::at_t<2, y<0>, y<1>, y<2>>, y<2>>{}, "");
+
+        // make sure it works with non-object types
+        static_assert(std::is_same<vd::at_t<0, void, int&>, void>{}, "");
+        static_assert(std::is_same<vd::at_t<1, void, int&>, int&>{}, "");
+        static_assert(std::is_same<vd::at_t<1, void, int const>, int const>{}, "");
+        static_assert(std::is_same<vd::at_t<0, void(), int[]>, void()>{}, "");
+        static_assert(std::is_same<vd::at_t<1, void(), int[]>, int[]>{}, "");
+    }
 }
@@ -216,7 +216,36 @@ int main() {
             BOOST_HANA_CONSTANT_CHECK(not_(is_empty(mpl::vector2<t1, t2>{})));
         }
 
+        // at
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                at_c<0>(mpl::vector<t1>{}),
+                type<t1>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                at_c<1>(mpl::vector<t1, t2>{}),
+                type<t2>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                at_c<2>(mpl::vector3<t1, t2, t3>{}),
+                type<t3>
+            ));
+        }
+
+        // last
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                last(mpl::vector<t1>{}),
+                type<t1>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                last(mpl::vector<t1, t2, t3>{}),
+                type<t3>
+            ));
+        }
+
         // laws
+        static_assert(_models<RandomAccessIterable, ext::boost::mpl::Vector>{}, "");
         test::TestIterable<ext::boost::mpl::Vector>{vectors};
     }
 
@@ -11,11 +11,13 @@ Distributed under the Boost Software License, Version 1.0.
 #include <laws/base.hpp>
 #include <laws/comparable.hpp>
 #include <laws/foldable.hpp>
+#include <laws/functor.hpp>
 #include <laws/iterable.hpp>
 #include <laws/orderable.hpp>
 #include <laws/searchable.hpp>
 
 #include <array>
+#include <memory>
 using namespace boost::hana;
 
 
@@ -51,7 +53,37 @@ int main() {
     //////////////////////////////////////////////////////////////////////////
     // Foldable
     //////////////////////////////////////////////////////////////////////////
-    test::TestFoldable<ext::std::Array>{int_arrays};
+    {
+        // length
+        BOOST_HANA_CONSTANT_CHECK(equal(length(array<>()), size_t<0>));
+        BOOST_HANA_CONSTANT_CHECK(equal(length(array<0, 1, 2>()), size_t<3>));
+
+        // unpack
+        BOOST_HANA_CONSTEXPR_CHECK(
+            unpack(array<1, 2, 3>(), [](int a, int b, int c) {
+                return a == 1 && b == 2 && c == 3;
+            })
+        );
+
+        // for_each
+        {
+            int sum = 0;
+            for_each(array<1, 2, 3>(), [&](int i) { sum += i; });
+            BOOST_HANA_RUNTIME_CHECK(sum == 6);
+        }
+
+        // the elements of rvalue arrays are moved
+        {
+            using Ptr = std::unique_ptr<int>;
+            std::array<Ptr, 2> ptrs{{Ptr{new int{1}}, Ptr{new int{2}}}};
+            Ptr sum = fold.left(std::move(ptrs), Ptr{new int{0}},
+                [](Ptr s, Ptr p) { return Ptr{new int{*s + *p}}; });
+            BOOST_HANA_RUNTIME_CHECK(*sum == 3);
+        }
+
+        // laws
+        test::TestFoldable<ext::std::Array>{int_arrays};
+    }
 
 #elif BOOST_HANA_TEST_PART == 4
     //////////////////////////////////////////////////////////////////////////
@@ -92,7 +124,46 @@ int main() {
             ));
         }
 
+        // at
+        {
+            BOOST_HANA_CONSTEXPR_CHECK(at_c<0>(array<0>()) == 0);
+            BOOST_HANA_CONSTEXPR_CHECK(at_c<1>(array<0, 1, 2>()) == 1);
+            BOOST_HANA_CONSTEXPR_CHECK(at_c<2>(array<0, 1, 2>()) == 2);
+
+            std::array<int, 2> xs{{0, 1}};
+            at_c<1>(xs) = 3;
+            BOOST_HANA_RUNTIME_CHECK(xs[1] == 3);
+        }
+
+        // last
+        {
+            BOOST_HANA_CONSTEXPR_CHECK(last(array<0>()) == 0);
+            BOOST_HANA_CONSTEXPR_CHECK(last(array<0, 1>()) == 1);
+            BOOST_HANA_CONSTEXPR_CHECK(last(array<0, 1, 2>()) == 2);
+        }
+
+        // drop
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                drop(size_t<1>, array<0>()),
+                array<>()
+            ));
+            BOOST_HANA_CONSTEXPR_CHECK(equal(
+                drop(size_t<0>, array<0, 1>()),
+                array<0, 1>()
+            ));
+            BOOST_HANA_CONSTEXPR_CHECK(equal(
+                drop(size_t<2>, array<0, 1, 2>()),
+                array<2>()
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                drop(size_t<5>, array<0, 1, 2>()),
+                array<>()
+            ));
+        }
+
         // laws
+        static_assert(_models<RandomAccessIterable, ext::std::Array>{}, "");
         test::TestIterable<ext::std::Array>{int_arrays};
     }
 
@@ -112,6 +183,46 @@ int main() {
         auto eq_keys = make<Tuple>(ct_eq<0>{});
 
         test::TestSearchable<ext::std::Array>{eq_arrays, eq_keys};
+
+        // any_of with a predicate returning runtime booleans
+        BOOST_HANA_RUNTIME_CHECK(any_of(array<0, 1, 2>(), [](int i) {
+            return i == 1;
+        }));
+        BOOST_HANA_RUNTIME_CHECK(!any_of(array<0, 1, 2>(), [](int i) {
+            return i == 3;
+        }));
+    }
+
+#elif BOOST_HANA_TEST_PART == 6
+    //////////////////////////////////////////////////////////////////////////
+    // Functor
+    //////////////////////////////////////////////////////////////////////////
+    {
+        // transform
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                transform(array<>(), [](int i) { return i + 1; }),
+                array<>()
+            ));
+            BOOST_HANA_CONSTEXPR_CHECK(equal(
+                transform(array<0, 1, 2>(), [](int i) { return i + 1; }),
+                array<1, 2, 3>()
+            ));
+
+            std::array<double, 2> doubled = transform(array<1, 2>(), [](int i) {
+                return i * 2.5;
+            });
+            BOOST_HANA_RUNTIME_CHECK(doubled[0] == 2.5 && doubled[1] == 5.0);
+        }
+
+        // laws
+        auto eq_arrays = make<Tuple>(
+              std::array<ct_eq<0>, 0>{}
+            , std::array<ct_eq<0>, 1>{}
+            , std::array<ct_eq<0>, 2>{}
+            , std::array<ct_eq<0>, 3>{}
+        );
+        test::TestFunctor<ext::std::Array>{eq_arrays, make<Tuple>(ct_eq<0>{})};
     }
 #endif
 }
@@ -32,6 +32,7 @@ Distributed under the Boost Software License, Version 1.0.
 #endif
 #include <laws/sequence.hpp>
 
+#include <memory>
 #include <tuple>
 using namespace boost::hana;
 
@@ -108,6 +109,14 @@ int main() {
             , std::make_tuple(false_, false_)
         );
         test::TestSearchable<ext::std::Tuple>{bools, make<Tuple>(true_, false_)};
+
+        // any_of with a predicate returning runtime booleans
+        BOOST_HANA_RUNTIME_CHECK(any_of(std::make_tuple(1, '2', 3.3), [](auto x) {
+            return x == '2';
+        }));
+        BOOST_HANA_RUNTIME_CHECK(!any_of(std::make_tuple(1, '2', 3.3), [](auto x) {
+            return x == 4;
+        }));
     }
 
 #elif BOOST_HANA_TEST_PART == 2
@@ -128,7 +137,21 @@ int main() {
     // Foldable, Iterable, Traversable
     //////////////////////////////////////////////////////////////////////////
     test::TestFoldable<ext::std::Tuple>{big_eq_tuples};
+    {
+        // for_each
+        int sum = 0;
+        for_each(std::make_tuple(1, 2l, 3ll), [&](auto i) { sum += i; });
+        BOOST_HANA_RUNTIME_CHECK(sum == 6);
+
+        // the elements of rvalue tuples are moved
+        using Ptr = std::unique_ptr<int>;
+        BOOST_HANA_RUNTIME_CHECK(
+            unpack(std::make_tuple(Ptr{new int{1}}, Ptr{new int{2}}),
+                [](Ptr a, Ptr b) { return *a + *b; }) == 3
+        );
+    }
     test::TestIterable<ext::std::Tuple>{big_eq_tuples};
+    static_assert(_models<RandomAccessIterable, ext::std::Tuple>{}, "");
     test::TestTraversable<ext::std::Tuple>{};
 
 #elif BOOST_HANA_TEST_PART == 5
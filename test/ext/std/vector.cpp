@@ -14,6 +14,7 @@ Distributed under the Boost Software License, Version 1.0.
 // #include <laws/functor.hpp>
 #include <laws/orderable.hpp>
 
+#include <string>
 #include <vector>
 using namespace boost::hana;
 
@@ -43,4 +44,64 @@ int main() {
     test::TestComparable<ext::std::Vector>{eqs};
     test::TestOrderable<ext::std::Vector>{ords};
     // test::TestFunctor<ext::std::Vector>{eqs, eq_values};
+
+    //////////////////////////////////////////////////////////////////////////
+    // transform
+    //////////////////////////////////////////////////////////////////////////
+    {
+        std::vector<int> ints{1, 2, 3};
+        auto plus_one = [](int i) { return i + 1; };
+
+        BOOST_HANA_RUNTIME_CHECK(
+            transform(ints, plus_one) == std::vector<int>{2, 3, 4}
+        );
+        BOOST_HANA_RUNTIME_CHECK(ints == std::vector<int>{1, 2, 3});
+
+        BOOST_HANA_RUNTIME_CHECK(
+            transform(ints, [](int i) { return i * 0.5; })
+                == std::vector<double>{0.5, 1.0, 1.5}
+        );
+
+        BOOST_HANA_RUNTIME_CHECK(
+            transform(std::vector<int>{}, plus_one) == std::vector<int>{}
+        );
+
+        // rvalue vectors are transformed in-place
+        std::vector<int> moved = transform(std::move(ints), plus_one);
+        BOOST_HANA_RUNTIME_CHECK(moved == std::vector<int>{2, 3, 4});
+
+        std::vector<std::string> strings{"a", "b"};
+        auto const* data = strings.data();
+        std::vector<std::string> appended = transform(std::move(strings),
+            [](std::string s) { return s + "!"; });
+        BOOST_HANA_RUNTIME_CHECK(
+            appended == std::vector<std::string>{"a!", "b!"}
+        );
+        BOOST_HANA_RUNTIME_CHECK(appended.data() == data);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Foldable
+    //////////////////////////////////////////////////////////////////////////
+    {
+        std::vector<int> ints{1, 2, 3};
+        auto minus = [](auto x, auto y) { return x - y; };
+
+        // fold.left
+        BOOST_HANA_RUNTIME_CHECK(fold.left(ints, 0, minus) == ((0 - 1) - 2) - 3);
+        BOOST_HANA_RUNTIME_CHECK(fold.left(std::vector<int>{}, 0, minus) == 0);
+        BOOST_HANA_RUNTIME_CHECK(fold.left(ints, 0.5, minus) == 0.5 - 6);
+        BOOST_HANA_RUNTIME_CHECK(fold.left(ints, minus) == (1 - 2) - 3);
+
+        // fold.right
+        BOOST_HANA_RUNTIME_CHECK(fold.right(ints, 0, minus) == 1 - (2 - (3 - 0)));
+        BOOST_HANA_RUNTIME_CHECK(fold.right(std::vector<int>{}, 0, minus) == 0);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(ints, minus) == 1 - (2 - 3));
+
+        // for_each
+        std::vector<int> seen;
+        for_each(ints, [&](int i) { seen.push_back(i); });
+        BOOST_HANA_RUNTIME_CHECK(seen == ints);
+    }
+
 }
@@ -15,6 +15,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/hana/foldable.hpp>
 #include <boost/hana/iterable.hpp>
 #include <boost/hana/monad_plus.hpp>
+#include <boost/hana/random_access_iterable.hpp>
 #include <boost/hana/sequence.hpp>
 #include <boost/hana/tuple.hpp>
 
@@ -48,9 +49,32 @@ namespace boost { namespace hana {
     //  BOOST_HANA_TEST_FOLDABLE_UNPACK_MCD
     //  BOOST_HANA_TEST_FOLDABLE_ITERABLE_MCD
     //
-    // If neither is defined, the MCD used is unspecified.
+    // If neither is defined, the MCD used is unspecified. When
+    // BOOST_HANA_TEST_RANDOM_ACCESS_ITERABLE is defined, the methods
+    // provided by RandomAccessIterable are used instead.
     //////////////////////////////////////////////////////////////////////////
-#ifdef BOOST_HANA_TEST_FOLDABLE_FOLDS_MCD
+#ifdef BOOST_HANA_TEST_RANDOM_ACCESS_ITERABLE
+    template <>
+    struct unpack_impl<test::Seq>
+        : RandomAccessIterable::unpack_impl<test::Seq>
+    { };
+    template <>
+    struct fold_left_impl<test::Seq>
+        : RandomAccessIterable::fold_left_impl<test::Seq>
+    { };
+    template <>
+    struct fold_left_nostate_impl<test::Seq>
+        : RandomAccessIterable::fold_left_nostate_impl<test::Seq>
+    { };
+    template <>
+    struct fold_right_impl<test::Seq>
+        : RandomAccessIterable::fold_right_impl<test::Seq>
+    { };
+    template <>
+    struct fold_right_nostate_impl<test::Seq>
+        : RandomAccessIterable::fold_right_nostate_impl<test::Seq>
+    { };
+#elif defined(BOOST_HANA_TEST_FOLDABLE_FOLDS_MCD)
     template <>
     struct fold_right_impl<test::Seq> {
         template <typename Xs, typename S, typename F>
@@ -94,7 +118,53 @@ namespace boost { namespace hana {
 
     //////////////////////////////////////////////////////////////////////////
     // Iterable
+    //
+    // When BOOST_HANA_TEST_RANDOM_ACCESS_ITERABLE is defined, `at` and
+    // `length` are also provided, which makes `test::Seq` a model of
+    // RandomAccessIterable, and its provided methods are used.
     //////////////////////////////////////////////////////////////////////////
+#ifdef BOOST_HANA_TEST_RANDOM_ACCESS_ITERABLE
+    template <>
+    struct at_impl<test::Seq> {
+        template <typename N, typename Xs>
+        static constexpr decltype(auto) apply(N n, Xs&& xs) {
+            return hana::at(n, static_cast<Xs&&>(xs).storage);
+        }
+    };
+
+    template <>
+    struct length_impl<test::Seq> {
+        template <typename Xs>
+        static constexpr auto apply(Xs const& xs) {
+            return hana::length(xs.storage);
+        }
+    };
+
+    template <>
+    struct head_impl<test::Seq>
+        : RandomAccessIterable::head_impl<test::Seq>
+    { };
+
+    template <>
+    struct is_empty_impl<test::Seq>
+        : RandomAccessIterable::is_empty_impl<test::Seq>
+    { };
+
+    template <>
+    struct last_impl<test::Seq>
+        : RandomAccessIterable::last_impl<test::Seq>
+    { };
+
+    template <>
+    struct find_if_impl<test::Seq>
+        : RandomAccessIterable::find_if_impl<test::Seq>
+    { };
+
+    template <>
+    struct any_of_impl<test::Seq>
+        : RandomAccessIterable::any_of_impl<test::Seq>
+    { };
+#else
     template <>
     struct head_impl<test::Seq> {
         template <typename Xs>
@@ -104,18 +174,19 @@ namespace boost { namespace hana {
     };
 
     template <>
-    struct tail_impl<test::Seq> {
+    struct is_empty_impl<test::Seq> {
         template <typename Xs>
         static constexpr auto apply(Xs xs) {
-            return hana::unpack(hana::tail(xs.storage), test::seq);
+            return hana::is_empty(xs.storage);
         }
     };
+#endif
 
     template <>
-    struct is_empty_impl<test::Seq> {
+    struct tail_impl<test::Seq> {
         template <typename Xs>
         static constexpr auto apply(Xs xs) {
-            return hana::is_empty(xs.storage);
+            return hana::unpack(hana::tail(xs.storage), test::seq);
         }
     };
 
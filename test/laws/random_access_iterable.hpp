@@ -0,0 +1,125 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_HANA_TEST_LAWS_RANDOM_ACCESS_ITERABLE_HPP
+#define BOOST_HANA_TEST_LAWS_RANDOM_ACCESS_ITERABLE_HPP
+
+#include <boost/hana/assert.hpp>
+#include <boost/hana/bool.hpp>
+#include <boost/hana/comparable.hpp>
+#include <boost/hana/core/models.hpp>
+#include <boost/hana/core/when.hpp>
+#include <boost/hana/foldable.hpp>
+#include <boost/hana/functional/always.hpp>
+#include <boost/hana/functional/capture.hpp>
+#include <boost/hana/iterable.hpp>
+#include <boost/hana/lazy.hpp>
+#include <boost/hana/random_access_iterable.hpp>
+#include <boost/hana/range.hpp>
+#include <boost/hana/searchable.hpp>
+#include <boost/hana/tuple.hpp>
+
+#include <laws/base.hpp>
+
+
+namespace boost { namespace hana { namespace test {
+    template <typename It, typename = when<true>>
+    struct TestRandomAccessIterable : TestRandomAccessIterable<It, laws> {
+        using TestRandomAccessIterable<It, laws>::TestRandomAccessIterable;
+    };
+
+    template <typename It>
+    struct TestRandomAccessIterable<It, laws> {
+        static_assert(_models<RandomAccessIterable, It>{}, "");
+
+        template <typename Xs>
+        TestRandomAccessIterable(Xs xs) {
+            hana::for_each(xs, [](auto xs) {
+                // length(xs) == n
+                BOOST_HANA_CONSTANT_CHECK(hana::equal(
+                    hana::length(xs),
+                    hana::length(hana::to<Tuple>(xs))
+                ));
+
+                // at(i, xs) == xi+1
+                hana::for_each(hana::make_range(size_t<0>, hana::length(xs)),
+                hana::capture(xs)([](auto xs, auto n) {
+                    BOOST_HANA_CHECK(hana::equal(
+                        hana::at(n, xs),
+                        hana::at(n, hana::to<Tuple>(xs))
+                    ));
+                }));
+
+                // The provided methods are equivalent to the ones based on
+                // `head` and `tail`, or to `at` and `length`.
+                BOOST_HANA_CONSTANT_CHECK(hana::equal(
+                    RandomAccessIterable::is_empty_impl<It>::apply(xs),
+                    hana::equal(hana::length(xs), size_t<0>)
+                ));
+
+                BOOST_HANA_CHECK(hana::equal(
+                    RandomAccessIterable::unpack_impl<It>::apply(xs, make<Tuple>),
+                    Iterable::fold_left_impl<It>::apply(
+                        xs, make<Tuple>(), hana::append)
+                ));
+
+                BOOST_HANA_CHECK(hana::equal(
+                    RandomAccessIterable::fold_left_impl<It>::apply(
+                        xs, make<Tuple>(), hana::append),
+                    Iterable::fold_left_impl<It>::apply(
+                        xs, make<Tuple>(), hana::append)
+                ));
+
+                BOOST_HANA_CHECK(hana::equal(
+                    RandomAccessIterable::fold_right_impl<It>::apply(
+                        xs, make<Tuple>(), hana::prepend),
+                    Iterable::fold_right_impl<It>::apply(
+                        xs, make<Tuple>(), hana::prepend)
+                ));
+
+                BOOST_HANA_CONSTANT_CHECK(hana::equal(
+                    RandomAccessIterable::any_of_impl<It>::apply(
+                        xs, hana::always(true_)),
+                    Iterable::any_of_impl<It>::apply(xs, hana::always(true_))
+                ));
+
+                BOOST_HANA_CHECK(hana::equal(
+                    RandomAccessIterable::find_if_impl<It>::apply(
+                        xs, hana::always(true_)),
+                    Iterable::find_if_impl<It>::apply(xs, hana::always(true_))
+                ));
+
+                only_when_(hana::not_(hana::is_empty(xs)), hana::lazy([](auto xs) {
+                    BOOST_HANA_CHECK(hana::equal(
+                        RandomAccessIterable::head_impl<It>::apply(xs),
+                        hana::at(size_t<0>, xs)
+                    ));
+
+                    BOOST_HANA_CHECK(hana::equal(
+                        RandomAccessIterable::last_impl<It>::apply(xs),
+                        hana::at(hana::pred(hana::length(xs)), xs)
+                    ));
+
+                    BOOST_HANA_CHECK(hana::equal(
+                        RandomAccessIterable::fold_left_nostate_impl<It>::apply(
+                            xs, make<Tuple>),
+                        Iterable::fold_left_nostate_impl<It>::apply(
+                            xs, make<Tuple>)
+                    ));
+
+                    BOOST_HANA_CHECK(hana::equal(
+                        RandomAccessIterable::fold_right_nostate_impl<It>::apply(
+                            xs, make<Tuple>),
+                        Iterable::fold_right_nostate_impl<It>::apply(
+                            xs, make<Tuple>)
+                    ));
+                })(xs));
+            });
+        }
+    };
+}}} // end namespace boost::hana::test
+
+#endif // !BOOST_HANA_TEST_LAWS_RANDOM_ACCESS_ITERABLE_HPP
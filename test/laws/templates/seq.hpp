@@ -20,6 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <laws/monad.hpp>
 #include <laws/monad_plus.hpp>
 #include <laws/orderable.hpp>
+#include <laws/random_access_iterable.hpp>
 #include <laws/searchable.hpp>
 #include <laws/sequence.hpp>
 #include <laws/traversable.hpp>
@@ -148,6 +149,13 @@ int main() {
         // laws
         test::TestIterable<test::Seq>{eqs};
     }
+
+#ifdef BOOST_HANA_TEST_RANDOM_ACCESS_ITERABLE
+    //////////////////////////////////////////////////////////////////////////
+    // RandomAccessIterable
+    //////////////////////////////////////////////////////////////////////////
+    test::TestRandomAccessIterable<test::Seq>{eqs};
+#endif
 #endif
 
     //////////////////////////////////////////////////////////////////////////
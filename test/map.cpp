@@ -8,9 +8,12 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/assert.hpp>
 #include <boost/hana/core/operators.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/maybe.hpp>
 #include <boost/hana/pair.hpp>
+#include <boost/hana/string.hpp>
 #include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
 
 #include <laws/base.hpp>
 #include <laws/comparable.hpp>
@@ -32,6 +35,8 @@ auto p = test::minimal_product(key<i>, val<j>);
 
 struct undefined { };
 
+struct member { int x; };
+
 int main() {
     auto list = test::seq; (void)list;
     auto foldable = test::seq; (void)foldable;
@@ -428,5 +433,90 @@ int main() {
 
     // laws
     test::TestFoldable<Map>{eq_maps};
+
+#elif BOOST_HANA_TEST_PART == 8
+    //////////////////////////////////////////////////////////////////////////
+    // Lookup of keys with a canonical type (through the index)
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto m = make<Map>(
+            make<Pair>(type<int>, val<1>),
+            make<Pair>(int_<2>, val<2>),
+            make<Pair>(BOOST_HANA_STRING("abc"), val<3>),
+            make<Pair>(llong<-4>, val<4>)
+        );
+
+        // find
+        BOOST_HANA_CONSTANT_CHECK(equal(find(m, type<int>), just(val<1>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(m, int_<2>), just(val<2>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(m, long_<2>), just(val<2>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(m, ullong<2>), just(val<2>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(m, BOOST_HANA_STRING("abc")), just(val<3>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(m, int_<-4>), just(val<4>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(m, type<long>), nothing));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(m, int_<4>), nothing));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(m, BOOST_HANA_STRING("ab")), nothing));
+
+        // a key without a canonical type is searched linearly
+        BOOST_HANA_CONSTANT_CHECK(equal(find(m, key<1>), nothing));
+
+        // at_key
+        BOOST_HANA_CONSTANT_CHECK(equal(at_key(m, type<int>), val<1>));
+        BOOST_HANA_CONSTANT_CHECK(equal(at_key(m, long_<2>), val<2>));
+        BOOST_HANA_CONSTANT_CHECK(equal(at_key(m, BOOST_HANA_STRING("abc")), val<3>));
+        BOOST_HANA_CONSTANT_CHECK(equal(m[llong<-4>], val<4>));
+
+        // contains
+        BOOST_HANA_CONSTANT_CHECK(contains(m, type<int>));
+        BOOST_HANA_CONSTANT_CHECK(contains(m, integral_constant<unsigned, 2>));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(m, type<int*>)));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(m, int_<3>)));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(m, key<1>)));
+
+        // insert
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            insert(m, make<Pair>(long_<2>, val<99>)),
+            m
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            at_key(insert(m, make<Pair>(type<char>, val<5>)), type<char>),
+            val<5>
+        ));
+
+        // maps mixing canonical and non-canonical keys fall back to a
+        // linear search
+        auto mixed = make<Map>(
+            make<Pair>(type<int>, val<1>),
+            p<2, 2>
+        );
+        BOOST_HANA_CONSTANT_CHECK(equal(find(mixed, type<int>), just(val<1>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(mixed, key<2>), just(val<2>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(mixed, type<char>), nothing));
+
+        // runtime values
+        auto runtime = make<Map>(make<Pair>(int_<0>, 3), make<Pair>(type<int>, 'x'));
+        BOOST_HANA_RUNTIME_CHECK(at_key(runtime, int_<0>) == 3);
+        BOOST_HANA_RUNTIME_CHECK(runtime[type<int>] == 'x');
+
+        // keys deriving from a key with a canonical type (e.g. a Tuple
+        // storing it as a base class) don't get its canonical type
+        auto tuples = make<Map>(
+            make<Pair>(make<Tuple>(type<int>), 1),
+            make<Pair>(make<Tuple>(type<char>), 2)
+        );
+        BOOST_HANA_RUNTIME_CHECK(at_key(tuples, make<Tuple>(type<int>)) == 1);
+        BOOST_HANA_RUNTIME_CHECK(at_key(tuples, make<Tuple>(type<char>)) == 2);
+        BOOST_HANA_CONSTANT_CHECK(contains(tuples, make<Tuple>(type<int>)));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(tuples, make<Tuple>(type<long>))));
+
+        // IntegralConstants holding a non-integral value have no canonical
+        // type; they are searched linearly
+        auto members = make<Map>(
+            make<Pair>(integral_constant<int member::*, &member::x>, 1)
+        );
+        BOOST_HANA_RUNTIME_CHECK(
+            members[integral_constant<int member::*, &member::x>] == 1
+        );
+    }
 #endif
 }
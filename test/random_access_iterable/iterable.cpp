@@ -0,0 +1,9 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#define BOOST_HANA_TEST_RANDOM_ACCESS_ITERABLE
+#define BOOST_HANA_TEST_ITERABLE
+#include <laws/templates/seq.hpp>
@@ -8,8 +8,12 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/assert.hpp>
 #include <boost/hana/core/operators.hpp>
+#include <boost/hana/detail/std/is_same.hpp>
+#include <boost/hana/integral_constant.hpp>
 #include <boost/hana/maybe.hpp>
+#include <boost/hana/string.hpp>
 #include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
 
 #include <laws/base.hpp>
 #include <laws/comparable.hpp>
@@ -284,5 +288,79 @@ int main() {
         // laws
         test::TestFoldable<Set>{eqs};
     }
+
+#elif BOOST_HANA_TEST_PART == 5
+    //////////////////////////////////////////////////////////////////////////
+    // Elements with a canonical type (looked up through the index)
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto s = set(type<int>, int_<1>, BOOST_HANA_STRING("abc"));
+
+        // contains
+        BOOST_HANA_CONSTANT_CHECK(contains(s, type<int>));
+        BOOST_HANA_CONSTANT_CHECK(contains(s, long_<1>));
+        BOOST_HANA_CONSTANT_CHECK(contains(s, BOOST_HANA_STRING("abc")));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(s, type<char>)));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(s, int_<2>)));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(s, ct_eq<0>{})));
+
+        // find
+        BOOST_HANA_CONSTANT_CHECK(equal(find(s, type<int>), just(type<int>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(s, llong<1>), just(int_<1>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(find(s, type<char>), nothing));
+
+        // insert
+        BOOST_HANA_CONSTANT_CHECK(equal(insert(s, char_<1>), s));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            insert(s, type<char>),
+            set(type<int>, int_<1>, BOOST_HANA_STRING("abc"), type<char>)
+        ));
+
+        // Foldable -> Set
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Set>(tuple_t<int, char, int, float, char, int>),
+            set(type<int>, type<char>, type<float>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Set>(tuple_c<int, 3, 1, 3, 2, 1>),
+            set(int_<3>, int_<1>, int_<2>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Set>(make<Tuple>(int_<1>, long_<1>, type<int>, char_<1>)),
+            set(int_<1>, type<int>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Set>(make<Tuple>()),
+            set()
+        ));
+
+        // the first occurence of each element is kept
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Set>(make<Tuple>(long_<1>, int_<1>)),
+            set(long_<1>)
+        ));
+        static_assert(detail::std::is_same<
+            decltype(to<Set>(make<Tuple>(long_<1>, int_<1>))),
+            decltype(set(long_<1>))
+        >::value, "");
+
+        // mixing elements with and without a canonical type
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Set>(make<Tuple>(type<int>, ct_eq<0>{}, type<int>, ct_eq<0>{})),
+            set(type<int>, ct_eq<0>{})
+        ));
+
+        // elements deriving from an element with a canonical type (e.g. a
+        // Tuple storing it as a base class) don't get its canonical type
+        auto tuples = set(make<Tuple>(int_<1>), make<Tuple>(int_<2>));
+        BOOST_HANA_CONSTANT_CHECK(contains(tuples, make<Tuple>(int_<1>)));
+        BOOST_HANA_CONSTANT_CHECK(contains(tuples, make<Tuple>(long_<2>)));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(tuples, make<Tuple>(int_<3>))));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            to<Set>(make<Tuple>(make<Tuple>(int_<1>), make<Tuple>(int_<2>),
+                                make<Tuple>(int_<1>))),
+            tuples
+        ));
+    }
 #endif
 }
@@ -0,0 +1,69 @@
+/*
+@copyright Louis Dionne 2015
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/hana/tuple/core.hpp>
+
+#include <boost/hana/assert.hpp>
+
+#include <type_traits>
+using namespace boost::hana;
+
+
+// Only the core of `Tuple` is included; the operations it provides must
+// be usable without the rest of the library.
+
+struct T; struct U;
+
+int main() {
+    constexpr auto xs = make<Tuple>(1, '2', 3.3);
+
+    // at, at_c, head, tail, is_empty, length
+    {
+        static_assert(at(size_t<0>, xs) == 1, "");
+        static_assert(xs[size_t<1>] == '2', "");
+        static_assert(at_c<2>(xs) == 3.3, "");
+        static_assert(head(xs) == 1, "");
+        static_assert(head(tail(xs)) == '2', "");
+        static_assert(decltype(length(xs))::value == 3, "");
+        static_assert(!decltype(is_empty(xs))::value, "");
+        static_assert(decltype(is_empty(make<Tuple>()))::value, "");
+    }
+
+    // unpack and the folds
+    {
+        BOOST_HANA_RUNTIME_CHECK(unpack(xs, [](auto a, auto b, auto c) {
+            return a + b + c;
+        }) == 1 + '2' + 3.3);
+
+        auto f = [](auto s, auto x) { return s * 10 + x; };
+        BOOST_HANA_RUNTIME_CHECK(fold.left(make<Tuple>(1, 2, 3), 0, f) == 123);
+        BOOST_HANA_RUNTIME_CHECK(fold.left(make<Tuple>(1, 2, 3), f) == 123);
+
+        auto g = [](auto x, auto s) { return s * 10 + x; };
+        BOOST_HANA_RUNTIME_CHECK(fold.right(make<Tuple>(1, 2, 3), 0, g) == 321);
+        BOOST_HANA_RUNTIME_CHECK(fold.right(make<Tuple>(1, 2, 3), g) == 321);
+    }
+
+    // for_each
+    {
+        int sum = 0;
+        for_each(make<Tuple>(1, 2, 3), [&](int x) { sum += x; });
+        BOOST_HANA_RUNTIME_CHECK(sum == 6);
+
+        sum = 0;
+        for_each(tuple_c<int, 4, 5>, [&](auto x) { sum += x; });
+        BOOST_HANA_RUNTIME_CHECK(sum == 9);
+    }
+
+    // tuple_t and tuple_c
+    {
+        static_assert(std::is_same<
+            decltype(at(size_t<1>, tuple_t<T, U>))::type, U
+        >{}, "");
+        static_assert(decltype(length(tuple_t<T, U>))::value == 2, "");
+        static_assert(decltype(head(tuple_c<int, 4, 5>))::value == 4, "");
+    }
+}
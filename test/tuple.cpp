@@ -6,8 +6,10 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <boost/hana/tuple.hpp>
 
+#include <boost/hana/ext/std/integral_constant.hpp>
 #include <boost/hana/functional/always.hpp>
 #include <boost/hana/integral_constant.hpp>
+#include <boost/hana/pair.hpp>
 #include <boost/hana/type.hpp>
 
 #include <laws/applicative.hpp>
@@ -40,6 +42,9 @@ struct x0; struct x1; struct x2; struct x3; struct x4;
 template <typename ...>
 struct F { struct type; };
 
+template <typename T, typename U>
+struct smaller : std::integral_constant<bool, (sizeof(T) < sizeof(U))> { };
+
 // a non-movable, non-copyable type
 struct ref_only {
     test::Tracked _track{1};
@@ -206,6 +211,116 @@ int main() {
         >{}, "");
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // `tuple_t` and `tuple_c` are pure type lists without any storage, and
+    // the algorithms that can stay at the type level return type lists.
+    //////////////////////////////////////////////////////////////////////////
+    {
+        using Types = decltype(tuple_t<x0, x1, x2>);
+        using Ints = decltype(tuple_c<int, 0, 1, 2>);
+        static_assert(std::is_empty<Types>{}, "");
+        static_assert(std::is_empty<Ints>{}, "");
+        static_assert(!std::is_base_of<Types::storage, Types>{}, "");
+        static_assert(!std::is_base_of<Ints::storage, Ints>{}, "");
+
+        auto is_x1 = [](auto t) { return equal(t, type<x1>); };
+        auto odd = [](auto i) { return bool_<i() % 2 != 0>; };
+        static_assert(std::is_same<
+            decltype(filter(tuple_t<x0, x1, x2, x1>, is_x1)),
+            _tuple_t<x1, x1>::_
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(filter(tuple_c<int, 0, 1, 2, 3>, odd)),
+            _tuple_c<int, 1, 3>
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(filter(tuple_t<>, is_x1)), _tuple_t<>::_
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(transform(tuple_t<x0, x1>, metafunction<F>)),
+            _tuple_t<F<x0>::type, F<x1>::type>::_
+        >{}, "");
+
+        BOOST_HANA_CONSTANT_CHECK(equal(at_c<1>(tuple_t<x0, x1, x2>), type<x1>));
+        BOOST_HANA_CONSTANT_CHECK(equal(at_c<2>(tuple_c<int, 0, 1, 2>), int_<2>));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            unpack(tuple_t<x0, x1>, make<Tuple>),
+            make<Tuple>(type<x0>, type<x1>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            unpack(tuple_c<int, 0, 1>, make<Tuple>),
+            make<Tuple>(int_<0>, int_<1>)
+        ));
+
+        // Algorithms requiring value semantics use the storage of the list.
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            reverse(tuple_c<int, 0, 1, 2>),
+            tuple_c<int, 2, 1, 0>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            concat(tuple_t<x0>, make<Tuple>(type<x1>)),
+            tuple_t<x0, x1>
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            find_if(tuple_t<x0, x1, x2>, is_x1),
+            just(type<x1>)
+        ));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Algorithms on a `tuple_t` with a trait work at the type level
+    //////////////////////////////////////////////////////////////////////////
+    {
+        auto types = tuple_t<int, char*, void, float*>;
+        auto is_pointer = trait<std::is_pointer>;
+        auto is_void = integral(template_<std::is_void>);
+
+        static_assert(std::is_same<
+            decltype(filter(types, is_pointer)), _tuple_t<char*, float*>::_
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(remove_if(types, is_pointer)), _tuple_t<int, void>::_
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(sort(tuple_t<char[3], char, char[2]>, trait<smaller>)),
+            _tuple_t<char, char[2], char[3]>::_
+        >{}, "");
+        static_assert(std::is_same<
+            decltype(partition(types, is_pointer)),
+            decltype(make<Pair>(tuple_t<char*, float*>, tuple_t<int, void>))
+        >{}, "");
+
+        BOOST_HANA_CONSTANT_CHECK(equal(find_if(types, is_void), just(type<void>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            find_if(types, trait<std::is_reference>), nothing
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(count_if(types, is_pointer), size_t<2>));
+        BOOST_HANA_CONSTANT_CHECK(any_of(types, is_void));
+        BOOST_HANA_CONSTANT_CHECK(not_(all_of(types, is_pointer)));
+        BOOST_HANA_CONSTANT_CHECK(contains(types, type<void>));
+        BOOST_HANA_CONSTANT_CHECK(not_(contains(types, type<long>)));
+
+        // the results are the same as with an equivalent predicate
+        auto is_pointer_ = [](auto t) {
+            return trait<std::is_pointer>(t);
+        };
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            filter(types, is_pointer), filter(types, is_pointer_)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            remove_if(types, is_pointer), remove_if(types, is_pointer_)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            partition(types, is_pointer), partition(types, is_pointer_)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            sort(tuple_t<char[3], char, char[2]>, trait<smaller>),
+            sort(tuple_t<char[3], char, char[2]>, [](auto t, auto u) {
+                return trait<smaller>(t, u);
+            })
+        ));
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Comparable
     //////////////////////////////////////////////////////////////////////////
@@ -230,6 +345,21 @@ int main() {
         BOOST_HANA_CONSTANT_CHECK(equal(tuple_c<int, 0, 1>, tuple_c<int, 0, 1>));
         BOOST_HANA_CONSTANT_CHECK(equal(tuple_c<int, 0, 1, 2>, tuple_c<int, 0, 1, 2>));
 
+        // tuples whose elementwise comparisons are all Constants
+        BOOST_HANA_CONSTANT_CHECK(not_(equal(tuple_t<x0, x1>, tuple_t<x0, x2>)));
+        BOOST_HANA_CONSTANT_CHECK(equal(
+            tuple_t<x0, x1>, make<Tuple>(type<x0>, type<x1>)
+        ));
+        BOOST_HANA_CONSTANT_CHECK(not_(equal(
+            make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{}),
+            make<Tuple>(eq<0>{}, eq<3>{}, eq<2>{})
+        )));
+
+        // tuples with runtime elementwise comparisons
+        BOOST_HANA_RUNTIME_CHECK(equal(make<Tuple>(1, '2'), make<Tuple>(1, '2')));
+        BOOST_HANA_RUNTIME_CHECK(!equal(make<Tuple>(1, '2'), make<Tuple>(1, '3')));
+        BOOST_HANA_RUNTIME_CHECK(!equal(make<Tuple>(1, '2'), make<Tuple>(0, '2')));
+
         test::TestComparable<Tuple>{eq_tuples};
     }
 
@@ -239,6 +369,31 @@ int main() {
     //////////////////////////////////////////////////////////////////////////
     {
         test::TestOrderable<Tuple>{ord_tuples};
+
+        // tuples whose elementwise comparisons are all Constants
+        BOOST_HANA_CONSTANT_CHECK(less(
+            make<Tuple>(ord<0>{}, ord<1>{}),
+            make<Tuple>(ord<0>{}, ord<2>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(not_(less(
+            make<Tuple>(ord<0>{}, ord<2>{}),
+            make<Tuple>(ord<0>{}, ord<1>{}, ord<3>{})
+        )));
+        BOOST_HANA_CONSTANT_CHECK(less(
+            make<Tuple>(ord<0>{}, ord<1>{}),
+            make<Tuple>(ord<0>{}, ord<1>{}, ord<0>{})
+        ));
+        BOOST_HANA_CONSTANT_CHECK(not_(less(
+            make<Tuple>(ord<0>{}, ord<1>{}),
+            make<Tuple>(ord<0>{}, ord<1>{})
+        )));
+        BOOST_HANA_CONSTANT_CHECK(less(tuple_c<int, 1, 2>, tuple_c<int, 1, 3>));
+        BOOST_HANA_CONSTANT_CHECK(not_(less(tuple_c<int, 1, 3>, tuple_c<int, 1, 2>)));
+
+        // tuples with runtime elementwise comparisons
+        BOOST_HANA_RUNTIME_CHECK(less(make<Tuple>(1, 2), make<Tuple>(1, 3)));
+        BOOST_HANA_RUNTIME_CHECK(!less(make<Tuple>(1, 3), make<Tuple>(1, 2)));
+        BOOST_HANA_RUNTIME_CHECK(less(make<Tuple>(1), make<Tuple>(1, 0)));
     }
 
 #elif BOOST_HANA_TEST_PART == 3
@@ -340,6 +495,16 @@ int main() {
             ));
         }
 
+        // fold.left with tuple_t and an initial state that is not a Type
+        {
+            auto f = metafunction<F>;
+            struct non_type_state { };
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.left(tuple_t<x0, x1>, non_type_state{}, f),
+                f(f(non_type_state{}, type<x0>), type<x1>)
+            ));
+        }
+
         // fold.left with tuple_t and no initial state
         {
             auto f = metafunction<F>;
@@ -387,6 +552,16 @@ int main() {
             ));
         }
 
+        // fold.right with tuple_t and an initial state that is not a Type
+        {
+            auto f = metafunction<F>;
+            struct non_type_state { };
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                fold.right(tuple_t<x0, x1>, non_type_state{}, f),
+                f(type<x0>, f(type<x1>, non_type_state{}))
+            ));
+        }
+
         // fold.right with tuple_t and no initial state
         {
             auto f = metafunction<F>;
@@ -408,6 +583,60 @@ int main() {
             ));
         }
 
+        // sum, product, maximum, minimum and count with tuples of
+        // integral constants are computed without folding, but they
+        // must return the same thing as the default implementations
+        {
+            auto same = [](auto fast, auto folded) {
+                static_assert(std::is_same<
+                    decltype(fast), decltype(folded)
+                >{}, "");
+                BOOST_HANA_CONSTANT_CHECK(equal(fast, folded));
+            };
+            using Int = IntegralConstant<int>;
+            using Long = IntegralConstant<long>;
+            using Size = IntegralConstant<std::size_t>;
+
+            auto ints = tuple_c<int, 3, -1, 4, 1, -5, 9, 2>;
+            auto longs = tuple_c<long, 3, 1, 4>;
+            auto sizes = make_tuple(size_t<3>, size_t<1>, size_t<4>);
+
+            same(sum<>(ints), sum_impl<Tuple, when<true>>::apply<Int>(ints));
+            same(sum<>(longs), sum_impl<Tuple, when<true>>::apply<Int>(longs));
+            same(sum<Long>(ints), sum_impl<Tuple, when<true>>::apply<Long>(ints));
+            same(sum<Size>(sizes), sum_impl<Tuple, when<true>>::apply<Size>(sizes));
+            same(sum<>(tuple_c<int, 1>), sum_impl<Tuple, when<true>>::apply<Int>(tuple_c<int, 1>));
+            same(sum<>(tuple_c<int>), int_<0>);
+
+            same(product<>(ints), product_impl<Tuple, when<true>>::apply<Int>(ints));
+            same(product<>(longs), product_impl<Tuple, when<true>>::apply<Int>(longs));
+            same(product<Size>(sizes), product_impl<Tuple, when<true>>::apply<Size>(sizes));
+            same(product<>(tuple_c<int>), int_<1>);
+
+            same(maximum(ints), maximum_impl<Tuple, when<true>>::apply(ints));
+            same(maximum(sizes), maximum_impl<Tuple, when<true>>::apply(sizes));
+            same(maximum(tuple_c<int, 1>), int_<1>);
+            same(minimum(ints), minimum_impl<Tuple, when<true>>::apply(ints));
+            same(minimum(sizes), minimum_impl<Tuple, when<true>>::apply(sizes));
+            same(minimum(tuple_c<int, 1>), int_<1>);
+
+            same(count(ints, int_<4>), count_impl<Tuple, when<true>>::apply(ints, int_<4>));
+            same(count(ints, int_<0>), count_impl<Tuple, when<true>>::apply(ints, int_<0>));
+            same(count(ints, long_<4>), count_impl<Tuple, when<true>>::apply(ints, long_<4>));
+            same(count(tuple_c<int, 1, 1, 2>, int_<1>), size_t<2>);
+            same(count(sizes, size_t<1>), size_t<1>);
+
+            // tuples of mixed or runtime values still use the folds
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                sum<>(make_tuple(int_<1>, long_<2>)), long_<3>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                maximum(make_tuple(int_<1>, long_<2>, int_<0>)), long_<2>
+            ));
+            BOOST_HANA_RUNTIME_CHECK(sum<>(make_tuple(1, 2, 3)) == 6);
+            BOOST_HANA_RUNTIME_CHECK(count(make_tuple(1, 2, 1), 1) == 2u);
+        }
+
         test::TestFoldable<Tuple>{eq_tuples};
     }
 
@@ -510,6 +739,80 @@ int main() {
             , make<Tuple>(false_, false_)
         );
         test::TestSearchable<Tuple>{bool_tuples, make<Tuple>(true_, false_)};
+
+        // find_if, any_of, all_of and count_if with all the predicate
+        // results known at compile-time
+        {
+            auto z = eq<999>{};
+            auto xs = make<Tuple>(eq<0>{}, z, eq<1>{}, z);
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_if(xs, equal.to(z)), just(z)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_if(xs, equal.to(eq<1>{})), just(eq<1>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_if(xs, equal.to(eq<2>{})), nothing
+            ));
+
+            BOOST_HANA_CONSTANT_CHECK(any_of(xs, equal.to(z)));
+            BOOST_HANA_CONSTANT_CHECK(not_(any_of(xs, equal.to(eq<2>{}))));
+            BOOST_HANA_CONSTANT_CHECK(not_(any_of(make<Tuple>(), equal.to(z))));
+
+            BOOST_HANA_CONSTANT_CHECK(all_of(make<Tuple>(z, z), equal.to(z)));
+            BOOST_HANA_CONSTANT_CHECK(not_(all_of(xs, equal.to(z))));
+            BOOST_HANA_CONSTANT_CHECK(all_of(make<Tuple>(), equal.to(z)));
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                count_if(xs, equal.to(z)), size_t<2>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                count_if(xs, equal.to(eq<2>{})), size_t<0>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                count_if(make<Tuple>(), equal.to(z)), size_t<0>
+            ));
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_if(tuple_t<x0, x1, x2>, equal.to(type<x1>)),
+                just(type<x1>)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(any_of(tuple_t<x0, x1>, equal.to(type<x1>)));
+            BOOST_HANA_CONSTANT_CHECK(not_(all_of(tuple_t<x0, x1>, equal.to(type<x1>))));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                count_if(tuple_t<x0, x1, x0>, equal.to(type<x0>)), size_t<2>
+            ));
+        }
+
+        // find_if, any_of, all_of and none_of apply the predicate to every
+        // element, even past the first one deciding the result, but only to
+        // get the type of its results; the predicate is never called. Hence,
+        // this predicate only needs to be declared for every element.
+        {
+            struct is_x1_decl {
+                auto operator()(_type<x0> const&) const -> decltype(false_);
+                auto operator()(_type<x1> const&) const -> decltype(true_);
+                auto operator()(_type<x2> const&) const -> decltype(false_);
+            };
+            auto xs = make<Tuple>(type<x0>, type<x1>, type<x2>);
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                find_if(xs, is_x1_decl{}), just(type<x1>)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(any_of(xs, is_x1_decl{}));
+            BOOST_HANA_CONSTANT_CHECK(not_(all_of(xs, is_x1_decl{})));
+            BOOST_HANA_CONSTANT_CHECK(not_(none_of(xs, is_x1_decl{})));
+        }
+
+        // any_of and all_of with predicates returning runtime booleans
+        {
+            auto xs = make<Tuple>(1, 2, 3);
+            BOOST_HANA_RUNTIME_CHECK(any_of(xs, [](int x) { return x == 2; }));
+            BOOST_HANA_RUNTIME_CHECK(!any_of(xs, [](int x) { return x == 4; }));
+            BOOST_HANA_RUNTIME_CHECK(all_of(xs, [](int x) { return x > 0; }));
+            BOOST_HANA_RUNTIME_CHECK(!all_of(xs, [](int x) { return x > 1; }));
+        }
     }
 
 #elif BOOST_HANA_TEST_PART == 6
@@ -517,6 +820,146 @@ int main() {
     // Sequence
     //////////////////////////////////////////////////////////////////////////
     {
+        // sort with tuple_t and a predicate on Types
+        {
+            struct s1 { char c[1]; }; struct s2 { char c[2]; };
+            struct s3 { char c[3]; }; struct t2 { char c[2]; };
+            auto smaller = [](auto x, auto y) {
+                return sizeof_(x) < sizeof_(y);
+            };
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                sort(tuple_t<>, smaller),
+                tuple_t<>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                sort(tuple_t<s3, s1, s2>, smaller),
+                tuple_t<s1, s2, s3>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                sort(tuple_t<s2, s3, t2, s1>, smaller),
+                tuple_t<s1, s2, t2, s3>
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                sort(tuple_t<t2, s3, s2, s1>, smaller),
+                tuple_t<s1, t2, s2, s3>
+            ));
+        }
+
+        // take_while, take_until, drop_while, drop_until, span and
+        // partition with predicates evaluated on every element at once
+        {
+            auto z = eq<999>{};
+            auto xs = make<Tuple>(eq<0>{}, eq<1>{}, z, eq<2>{}, z);
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                take_while(xs, not_equal.to(z)),
+                make<Tuple>(eq<0>{}, eq<1>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                take_until(xs, equal.to(z)),
+                make<Tuple>(eq<0>{}, eq<1>{})
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                drop_while(xs, not_equal.to(z)),
+                make<Tuple>(z, eq<2>{}, z)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                drop_until(xs, equal.to(z)),
+                make<Tuple>(z, eq<2>{}, z)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                span(xs, not_equal.to(z)),
+                make<Pair>(make<Tuple>(eq<0>{}, eq<1>{}),
+                           make<Tuple>(z, eq<2>{}, z))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                partition(xs, not_equal.to(z)),
+                make<Pair>(make<Tuple>(eq<0>{}, eq<1>{}, eq<2>{}),
+                           make<Tuple>(z, z))
+            ));
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                take_while(make<Tuple>(), not_equal.to(z)),
+                make<Tuple>()
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                drop_while(make<Tuple>(eq<0>{}, eq<1>{}), not_equal.to(z)),
+                make<Tuple>()
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                partition(make<Tuple>(), not_equal.to(z)),
+                make<Pair>(make<Tuple>(), make<Tuple>())
+            ));
+
+            auto is_x0 = equal.to(type<x0>);
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                partition(tuple_t<x0, x1, x0, x2>, is_x0),
+                make<Pair>(tuple_t<x0, x0>, tuple_t<x1, x2>)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                span(tuple_t<x0, x0, x1, x0>, is_x0),
+                make<Pair>(tuple_t<x0, x0>, tuple_t<x1, x0>)
+            ));
+        }
+
+        // take_while, take_until, drop_while, drop_until and span apply the
+        // predicate to every element, even past the first one deciding the
+        // result, but only to get the type of its results; the predicate is
+        // never called. Hence, this predicate only needs to be declared for
+        // every element of the tuple.
+        {
+            struct is_x0_decl {
+                auto operator()(_type<x0> const&) const -> decltype(true_);
+                auto operator()(_type<x1> const&) const -> decltype(false_);
+                auto operator()(_type<x2> const&) const -> decltype(false_);
+            };
+            auto xs = make<Tuple>(type<x0>, type<x1>, type<x2>);
+
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                take_while(xs, is_x0_decl{}),
+                make<Tuple>(type<x0>)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                take_until(xs, is_x0_decl{}),
+                make<Tuple>()
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                drop_while(xs, is_x0_decl{}),
+                make<Tuple>(type<x1>, type<x2>)
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                drop_until(xs, is_x0_decl{}),
+                xs
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                span(xs, is_x0_decl{}),
+                make<Pair>(make<Tuple>(type<x0>), make<Tuple>(type<x1>, type<x2>))
+            ));
+        }
+
+        // group only compares adjacent elements
+        {
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                group(make<Tuple>()),
+                make<Tuple>()
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                group(make<Tuple>(eq<0>{})),
+                make<Tuple>(make<Tuple>(eq<0>{}))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                group(make<Tuple>(eq<0>{}, eq<0>{}, eq<1>{}, eq<0>{}, eq<0>{})),
+                make<Tuple>(make<Tuple>(eq<0>{}, eq<0>{}),
+                            make<Tuple>(eq<1>{}),
+                            make<Tuple>(eq<0>{}, eq<0>{}))
+            ));
+            BOOST_HANA_CONSTANT_CHECK(equal(
+                group(tuple_t<x0, x1, x1, x2>),
+                make<Tuple>(tuple_t<x0>, tuple_t<x1, x1>, tuple_t<x2>)
+            ));
+        }
+
         test::TestSequence<Tuple>{};
     }
 